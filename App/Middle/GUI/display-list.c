@@ -0,0 +1,570 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: display-list.c
+ *
+ * Description: Bo ghi va phat lai danh sach lenh ve cho man hinh ket qua.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "lcd.h"
+#include "lcd-seq.h"
+#include "gui-span.h"
+#include "display-list.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define DL_TEXT_MAX_LEN						0xFF
+
+typedef struct {
+	u16			wXs;
+	u16			wYs;
+	u16			wXe;
+	u16			wYe;
+}DlRect_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+// Bang font ASCII cua GUI.c (font.h): moi hang 1 byte, bit thap la cot trai
+extern const unsigned char asc2_1206[95][12];
+extern const unsigned char asc2_1608[95][16];
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static DlCmd_t *dlAppend(DisplayList_t *pDl,uint8_t byOp);
+
+static const char *dlFieldValue(const char * const *ppFieldValue,uint8_t byField);
+
+static uint8_t dlGlyphSize(uint8_t bySize);
+
+static uint8_t dlOpRect(DlCmd_t *pCmd,const char *pValue,DlRect_t *pRect);
+
+static uint8_t dlRectClip(DlRect_t *pRect);
+
+static uint8_t dlRectCovered(DisplayList_t *pDl,const DlRect_t *pRect);
+
+static void dlCompose(DisplayList_t *pDl,const DlRect_t *pRect,const char * const *ppFieldValue);
+
+static void dlComposeFill(u8 *pbyLine,const DlRect_t *pRect,u16 wXs,u16 wXe,u16 wColor);
+
+static void dlComposeText(DisplayList_t *pDl,u8 *pbyLine,const DlRect_t *pRect,u16 wY,
+		DlCmd_t *pCmd,const char *pStr,uint8_t byMaxLen);
+
+static void dlUpdateField(DisplayList_t *pDl,DlCmd_t *pCmd,const char * const *ppFieldValue);
+
+static void dlSaveField(DisplayList_t *pDl,DlCmd_t *pCmd,const char *pValue);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   dlInit
+ * @brief  Khoi tao danh sach lenh rong tren bo dem cua nguoi goi
+ * @param  pDl: Danh sach lenh
+ * @param  pBuf, byCapacity: Bo dem chua lenh va so lenh toi da
+ * @param  wFc, wBc: Mau chu va mau nen
+ * @retval None
+ */
+void dlInit(DisplayList_t *pDl,DlCmd_t *pBuf,uint8_t byCapacity,u16 wFc,u16 wBc)
+{
+	memset(pDl,0,sizeof(DisplayList_t));
+	pDl->pCmd = pBuf;
+	pDl->byCapacity = byCapacity;
+	pDl->wFc = wFc;
+	pDl->wBc = wBc;
+}
+/**
+ * @func   dlRecordClear
+ * @brief  Ghi lenh xoa vung (wXs,wYs)-(wXe,wYe) bang mau nen
+ * @param
+ * @retval None
+ */
+void dlRecordClear(DisplayList_t *pDl,u16 wXs,u16 wYs,u16 wXe,u16 wYe)
+{
+	DlCmd_t *pCmd = dlAppend(pDl, DL_OP_CLEAR);
+
+	if(pCmd != NULL)
+	{
+		pCmd->wXs = wXs;
+		pCmd->wYs = wYs;
+		pCmd->wXe = wXe;
+		pCmd->wYe = wYe;
+	}
+}
+/**
+ * @func   dlRecordText
+ * @brief  Ghi lenh in chuoi co dinh. Chuoi phai ton tai suot doi danh sach
+ * @param
+ * @retval None
+ */
+void dlRecordText(DisplayList_t *pDl,u16 wX,u16 wY,const char *pStr,uint8_t bySize)
+{
+	DlCmd_t *pCmd = dlAppend(pDl, DL_OP_TEXT);
+
+	if(pCmd != NULL)
+	{
+		pCmd->wXs = wX;
+		pCmd->wYs = wY;
+		pCmd->bySize = bySize;
+		pCmd->pStr = pStr;
+	}
+}
+/**
+ * @func   dlRecordField
+ * @brief  Ghi lenh in truong gia tri thu byField cua bang gia tri khi phat lai
+ * @param
+ * @retval None
+ */
+void dlRecordField(DisplayList_t *pDl,u16 wX,u16 wY,uint8_t byField,uint8_t bySize)
+{
+	DlCmd_t *pCmd;
+
+	if(byField >= DL_MAX_FIELDS)
+	{
+		return;
+	}
+	pCmd = dlAppend(pDl, DL_OP_FIELD);
+	if(pCmd != NULL)
+	{
+		pCmd->wXs = wX;
+		pCmd->wYs = wY;
+		pCmd->bySize = bySize;
+		pCmd->byField = byField;
+	}
+}
+/**
+ * @func   dlRecordHLine
+ * @brief  Ghi lenh ve duong ke ngang mau POINT_COLOR
+ * @param
+ * @retval None
+ */
+void dlRecordHLine(DisplayList_t *pDl,u16 wXs,u16 wXe,u16 wY)
+{
+	DlCmd_t *pCmd = dlAppend(pDl, DL_OP_HLINE);
+
+	if(pCmd != NULL)
+	{
+		pCmd->wXs = wXs;
+		pCmd->wXe = wXe;
+		pCmd->wYs = wY;
+		pCmd->wYe = wY;
+	}
+}
+/**
+ * @func   dlInvalidate
+ * @brief  Bao man hinh da bi ve de len, lan phat lai sau se ve lai toan bo
+ * @param  pDl: Danh sach lenh
+ * @retval None
+ */
+void dlInvalidate(DisplayList_t *pDl)
+{
+	pDl->byValid = 0;
+}
+/**
+ * @func   dlReplay
+ * @brief  Phat lai danh sach lenh theo dong quet: moi vung chu nhat duoc ghep
+ *         tat ca lenh cat qua no vao bo dem dong roi gui 1 cua so bang DMA.
+ *         Lan dau ve moi vung CLEAR (va lenh nam ngoai CLEAR), cac lan sau chi
+ *         ghep lai dai o ky tu cua truong co gia tri khac lan truoc
+ * @param  pDl: Danh sach lenh
+ * @param  ppFieldValue: Bang chuoi gia tri, danh chi so theo byField
+ * @retval None
+ */
+void dlReplay(DisplayList_t *pDl,const char * const *ppFieldValue)
+{
+	DlCmd_t *pCmd;
+	DlRect_t rect;
+	uint8_t i;
+
+	//GUI.c tu dat cua so rieng nen khong tin cua so dang luu
+	LCD_SeqInvalidate();
+	if(pDl->byValid == 0)
+	{
+		//1. Moi vung CLEAR ghep 1 lan cung chu, truong va duong ke ben trong
+		for(i = 0; i < pDl->byCount; i++)
+		{
+			pCmd = &pDl->pCmd[i];
+			if((pCmd->byOp == DL_OP_CLEAR)&&dlOpRect(pCmd, NULL, &rect))
+			{
+				dlCompose(pDl, &rect, ppFieldValue);
+			}
+		}
+		//2. Lenh nam ngoai moi vung CLEAR ghep rieng theo khung cua no
+		for(i = 0; i < pDl->byCount; i++)
+		{
+			pCmd = &pDl->pCmd[i];
+			if((pCmd->byOp == DL_OP_CLEAR)||
+					!dlOpRect(pCmd, dlFieldValue(ppFieldValue, pCmd->byField), &rect)||
+					dlRectCovered(pDl, &rect))
+			{
+				continue;
+			}
+			if(pCmd->byOp == DL_OP_HLINE)
+			{
+				guiSpanHLine(rect.wXs, rect.wXe, rect.wYs, POINT_COLOR);
+			}else
+			{
+				dlCompose(pDl, &rect, ppFieldValue);
+			}
+		}
+		for(i = 0; i < pDl->byCount; i++)
+		{
+			pCmd = &pDl->pCmd[i];
+			if(pCmd->byOp == DL_OP_FIELD)
+			{
+				dlSaveField(pDl, pCmd, dlFieldValue(ppFieldValue, pCmd->byField));
+			}
+		}
+	}else
+	{
+		//3. Chi ve lai cac o ky tu thay doi, duong ke cat qua duoc ghep lai luon
+		for(i = 0; i < pDl->byCount; i++)
+		{
+			pCmd = &pDl->pCmd[i];
+			if(pCmd->byOp == DL_OP_FIELD)
+			{
+				dlUpdateField(pDl, pCmd, ppFieldValue);
+			}
+		}
+	}
+	pDl->byValid = 1;
+}
+/**
+ * @func   dlAppend
+ * @brief  Lay o lenh tiep theo trong bo dem
+ * @param
+ * @retval Con tro toi lenh moi, NULL neu bo dem day
+ */
+static DlCmd_t *dlAppend(DisplayList_t *pDl,uint8_t byOp)
+{
+	DlCmd_t *pCmd;
+
+	if(pDl->byCount >= pDl->byCapacity)
+	{
+		return NULL;
+	}
+	pCmd = &pDl->pCmd[pDl->byCount++];
+	memset(pCmd,0,sizeof(DlCmd_t));
+	pCmd->byOp = byOp;
+	pDl->byValid = 0;
+	return pCmd;
+}
+/**
+ * @func   dlFieldValue
+ * @brief  Lay gia tri truong byField, NULL duoc coi la chuoi rong
+ * @param
+ * @retval Chuoi gia tri
+ */
+static const char *dlFieldValue(const char * const *ppFieldValue,uint8_t byField)
+{
+	if((ppFieldValue == NULL)||(ppFieldValue[byField] == NULL))
+	{
+		return "";
+	}
+	return ppFieldValue[byField];
+}
+/**
+ * @func   dlGlyphSize
+ * @brief  Co font thuc te: chi co 1206 va 1608, co lon hon dung 1608 nhu Show_Str
+ * @param
+ * @retval Chieu cao o ky tu
+ */
+static uint8_t dlGlyphSize(uint8_t bySize)
+{
+	return (bySize == 12) ? 12 : 16;
+}
+/**
+ * @func   dlOpRect
+ * @brief  Tinh khung bao cua 1 lenh (da cat theo man hinh)
+ * @param  pValue: Gia tri truong (FIELD), bo qua voi lenh khac
+ * @retval 0 neu lenh khong ve diem nao
+ */
+static uint8_t dlOpRect(DlCmd_t *pCmd,const char *pValue,DlRect_t *pRect)
+{
+	uint8_t bySize = dlGlyphSize(pCmd->bySize);
+	uint32_t dwLen;
+
+	pRect->wXs = pCmd->wXs;
+	pRect->wYs = pCmd->wYs;
+	pRect->wXe = pCmd->wXe;
+	pRect->wYe = pCmd->wYe;
+	if((pCmd->byOp == DL_OP_TEXT)||(pCmd->byOp == DL_OP_FIELD))
+	{
+		dwLen = strlen((pCmd->byOp == DL_OP_TEXT) ? pCmd->pStr : pValue);
+		if((pCmd->byOp == DL_OP_FIELD)&&(dwLen > DL_FIELD_MAX_LEN))
+		{
+			dwLen = DL_FIELD_MAX_LEN;
+		}
+		if(dwLen == 0)
+		{
+			return 0;
+		}
+		pRect->wXe = pCmd->wXs + dwLen*(bySize/2) - 1;
+		pRect->wYe = pCmd->wYs + bySize - 1;
+	}else if((pCmd->byOp == DL_OP_HLINE)&&(pRect->wXe < pRect->wXs))
+	{
+		pRect->wXs = pCmd->wXe;
+		pRect->wXe = pCmd->wXs;
+	}
+	return dlRectClip(pRect);
+}
+/**
+ * @func   dlRectClip
+ * @brief  Cat khung theo kich thuoc man hinh
+ * @param
+ * @retval 0 neu khung rong
+ */
+static uint8_t dlRectClip(DlRect_t *pRect)
+{
+	if(pRect->wXe >= lcddev.width)
+	{
+		pRect->wXe = lcddev.width - 1;
+	}
+	if(pRect->wYe >= lcddev.height)
+	{
+		pRect->wYe = lcddev.height - 1;
+	}
+	return (pRect->wXs <= pRect->wXe)&&(pRect->wYs <= pRect->wYe);
+}
+/**
+ * @func   dlRectCovered
+ * @brief  Kiem tra khung nam tron trong 1 vung CLEAR (da duoc ghep o buoc 1)
+ * @param
+ * @retval 1 neu nam trong
+ */
+static uint8_t dlRectCovered(DisplayList_t *pDl,const DlRect_t *pRect)
+{
+	DlCmd_t *pCmd;
+
+	for(uint8_t i = 0; i < pDl->byCount; i++)
+	{
+		pCmd = &pDl->pCmd[i];
+		if((pCmd->byOp == DL_OP_CLEAR)&&
+				(pRect->wXs >= pCmd->wXs)&&(pRect->wXe <= pCmd->wXe)&&
+				(pRect->wYs >= pCmd->wYs)&&(pRect->wYe <= pCmd->wYe))
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+/**
+ * @func   dlCompose
+ * @brief  Ghep moi dong cua khung tu nen va cac lenh cat qua no theo thu tu
+ *         ghi (lenh sau de len lenh truoc, duong ke luon tren cung), dong
+ *         N+1 duoc ghep trong khi DMA gui dong N
+ * @param  pRect: Khung da cat, rong <= LCD_SEQ_LINE_MAX/2
+ * @retval None
+ */
+static void dlCompose(DisplayList_t *pDl,const DlRect_t *pRect,const char * const *ppFieldValue)
+{
+	DlCmd_t *pCmd;
+	u8 *pbyLine;
+	u16 wBytes = (pRect->wXe - pRect->wXs + 1)*2;
+
+	LCD_SeqLineBegin(pRect->wXs, pRect->wYs, pRect->wXe, pRect->wYe);
+	for(u16 y = pRect->wYs; y <= pRect->wYe; y++)
+	{
+		pbyLine = LCD_SeqLineGet();
+		dlComposeFill(pbyLine, pRect, pRect->wXs, pRect->wXe, pDl->wBc);
+		for(uint8_t i = 0; i < pDl->byCount; i++)
+		{
+			pCmd = &pDl->pCmd[i];
+			if(pCmd->byOp == DL_OP_CLEAR)
+			{
+				if((y >= pCmd->wYs)&&(y <= pCmd->wYe))
+				{
+					dlComposeFill(pbyLine, pRect, pCmd->wXs, pCmd->wXe, pDl->wBc);
+				}
+			}else if(pCmd->byOp == DL_OP_TEXT)
+			{
+				dlComposeText(pDl, pbyLine, pRect, y, pCmd, pCmd->pStr, DL_TEXT_MAX_LEN);
+			}else if(pCmd->byOp == DL_OP_FIELD)
+			{
+				dlComposeText(pDl, pbyLine, pRect, y, pCmd,
+						dlFieldValue(ppFieldValue, pCmd->byField), DL_FIELD_MAX_LEN);
+			}
+		}
+		//Duong ke ghep sau cung de nen trang cua chu khong de len
+		for(uint8_t i = 0; i < pDl->byCount; i++)
+		{
+			pCmd = &pDl->pCmd[i];
+			if((pCmd->byOp == DL_OP_HLINE)&&(y == pCmd->wYs))
+			{
+				dlComposeFill(pbyLine, pRect, pCmd->wXs, pCmd->wXe, POINT_COLOR);
+			}
+		}
+		LCD_SeqLinePut(wBytes);
+	}
+	LCD_SeqLineEnd();
+}
+/**
+ * @func   dlComposeFill
+ * @brief  To doan [wXs, wXe] (thu tu bat ky) cua dong, cat theo khung
+ * @param
+ * @retval None
+ */
+static void dlComposeFill(u8 *pbyLine,const DlRect_t *pRect,u16 wXs,u16 wXe,u16 wColor)
+{
+	u16 wTmp;
+
+	if(wXe < wXs)
+	{
+		wTmp = wXs;
+		wXs = wXe;
+		wXe = wTmp;
+	}
+	if(wXs < pRect->wXs)
+	{
+		wXs = pRect->wXs;
+	}
+	if(wXe > pRect->wXe)
+	{
+		wXe = pRect->wXe;
+	}
+	for(u16 x = wXs; x <= wXe; x++)
+	{
+		pbyLine[2*(x - pRect->wXs)] = wColor>>8;
+		pbyLine[2*(x - pRect->wXs) + 1] = wColor;
+	}
+}
+/**
+ * @func   dlComposeText
+ * @brief  Ghep hang wY cua chuoi vao dong (che do co nen nhu LCD_ShowChar
+ *         mode 0). Dung o ky tu khong con vua man hinh nhu Show_Str
+ * @param
+ * @retval None
+ */
+static void dlComposeText(DisplayList_t *pDl,u8 *pbyLine,const DlRect_t *pRect,u16 wY,
+		DlCmd_t *pCmd,const char *pStr,uint8_t byMaxLen)
+{
+	uint8_t bySize = dlGlyphSize(pCmd->bySize);
+	uint8_t byCharW = bySize/2;
+	uint8_t byRow;
+	uint8_t byBits;
+	u16 wColor;
+	u16 wX;
+
+	if((wY < pCmd->wYs)||(wY >= pCmd->wYs + bySize))
+	{
+		return;
+	}
+	byRow = wY - pCmd->wYs;
+	for(uint8_t k = 0; (pStr[k] != 0)&&(k < byMaxLen); k++)
+	{
+		wX = pCmd->wXs + k*byCharW;
+		if((wX > pRect->wXe)||(wX > lcddev.width - byCharW))
+		{
+			break;
+		}
+		if(wX + byCharW <= pRect->wXs)
+		{
+			continue;
+		}
+		byBits = 0;
+		if((pStr[k] >= ' ')&&(pStr[k] <= '~'))
+		{
+			byBits = (bySize == 12) ? asc2_1206[pStr[k] - ' '][byRow] :
+					asc2_1608[pStr[k] - ' '][byRow];
+		}
+		for(uint8_t t = 0; t < byCharW; t++, wX++, byBits >>= 1)
+		{
+			if((wX < pRect->wXs)||(wX > pRect->wXe))
+			{
+				continue;
+			}
+			wColor = (byBits & 0x01) ? pDl->wFc : pDl->wBc;
+			pbyLine[2*(wX - pRect->wXs)] = wColor>>8;
+			pbyLine[2*(wX - pRect->wXs) + 1] = wColor;
+		}
+	}
+}
+/**
+ * @func   dlUpdateField
+ * @brief  So sanh gia tri moi voi gia tri dang hien thi va ghep lai 1 khung
+ *         tu o ky tu khac dau tien toi o khac cuoi cung (ca phan du khi gia
+ *         tri ngan hon). Duong ke va chu cat qua khung duoc ghep lai cung
+ * @param
+ * @retval None
+ */
+static void dlUpdateField(DisplayList_t *pDl,DlCmd_t *pCmd,const char * const *ppFieldValue)
+{
+	const char *pValue = dlFieldValue(ppFieldValue, pCmd->byField);
+	char *pcLast = pDl->pcFieldLast[pCmd->byField];
+	uint8_t bySize = dlGlyphSize(pCmd->bySize);
+	uint8_t byLast = (uint8_t)strlen(pcLast);
+	uint8_t byLen = 0;
+	uint8_t byFirst = 0;
+	uint8_t byEnd;
+	DlRect_t rect;
+
+	while((pValue[byLen] != 0)&&(byLen < DL_FIELD_MAX_LEN))
+	{
+		byLen++;
+	}
+	while((byFirst < byLen)&&(byFirst < byLast)&&(pValue[byFirst] == pcLast[byFirst]))
+	{
+		byFirst++;
+	}
+	byEnd = (byLen > byLast) ? byLen : byLast;
+	while((byEnd > byFirst)&&(byEnd <= byLen)&&(byEnd <= byLast)&&
+			(pValue[byEnd - 1] == pcLast[byEnd - 1]))
+	{
+		byEnd--;
+	}
+	if(byEnd == byFirst)
+	{
+		return;
+	}
+	rect.wXs = pCmd->wXs + byFirst*(bySize/2);
+	rect.wXe = pCmd->wXs + byEnd*(bySize/2) - 1;
+	rect.wYs = pCmd->wYs;
+	rect.wYe = pCmd->wYs + bySize - 1;
+	if(dlRectClip(&rect))
+	{
+		dlCompose(pDl, &rect, ppFieldValue);
+	}
+	dlSaveField(pDl, pCmd, pValue);
+}
+/**
+ * @func   dlSaveField
+ * @brief  Luu gia tri dang hien thi cua truong
+ * @param
+ * @retval None
+ */
+static void dlSaveField(DisplayList_t *pDl,DlCmd_t *pCmd,const char *pValue)
+{
+	char *pcLast = pDl->pcFieldLast[pCmd->byField];
+	uint8_t i;
+
+	for(i = 0; (pValue[i] != 0)&&(i < DL_FIELD_MAX_LEN); i++)
+	{
+		pcLast[i] = pValue[i];
+	}
+	pcLast[i] = 0;
+}
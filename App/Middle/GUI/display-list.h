@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: display-list.h
+ *
+ * Description: Ghi lai bo cuc man hinh co dinh (nhan, duong ke, truong gia tri)
+ *              thanh danh sach lenh, sau do phat lai chi voi gia tri thay doi.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _DISPLAY_LIST_H_
+#define _DISPLAY_LIST_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "lcd.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define DL_MAX_FIELDS						12
+#define DL_FIELD_MAX_LEN					24
+
+typedef enum {
+	DL_OP_CLEAR		= 0x00,		//Xoa vung chu nhat bang mau nen
+	DL_OP_TEXT		= 0x01,		//Chuoi co dinh
+	DL_OP_FIELD		= 0x02,		//Truong gia tri thay doi theo tung DUT
+	DL_OP_HLINE		= 0x03		//Duong ke ngang
+}DlOp_e;
+
+typedef struct {
+	uint8_t		byOp;
+	uint8_t		bySize;			//Co chu (TEXT/FIELD)
+	uint8_t		byField;		//Chi so truong (FIELD)
+	u16			wXs;
+	u16			wYs;
+	u16			wXe;			//Toa do ket thuc (CLEAR/HLINE)
+	u16			wYe;
+	const char	*pStr;			//Chuoi co dinh (TEXT)
+}DlCmd_t;
+
+typedef struct {
+	DlCmd_t		*pCmd;
+	uint8_t		byCapacity;
+	uint8_t		byCount;
+	uint8_t		byValid;		//Bo cuc tinh dang hien thi tren man hinh
+	u16			wFc;
+	u16			wBc;
+	char		pcFieldLast[DL_MAX_FIELDS][DL_FIELD_MAX_LEN + 1];	//Gia tri dang hien thi
+}DisplayList_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void dlInit(DisplayList_t *pDl,DlCmd_t *pBuf,uint8_t byCapacity,u16 wFc,u16 wBc);
+
+void dlRecordClear(DisplayList_t *pDl,u16 wXs,u16 wYs,u16 wXe,u16 wYe);
+
+void dlRecordText(DisplayList_t *pDl,u16 wX,u16 wY,const char *pStr,uint8_t bySize);
+
+void dlRecordField(DisplayList_t *pDl,u16 wX,u16 wY,uint8_t byField,uint8_t bySize);
+
+void dlRecordHLine(DisplayList_t *pDl,u16 wXs,u16 wXe,u16 wY);
+
+void dlInvalidate(DisplayList_t *pDl);
+
+void dlReplay(DisplayList_t *pDl,const char * const *ppFieldValue);
+
+#endif
@@ -0,0 +1,435 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: gui-span.c
+ *
+ * Description: Ve duong/hinh bang doan to (span): moi doan ngang/doc la 1 cua so
+ *              + 1 lan ghi lien tuc qua LCD_SeqFill thay vi LCD_DrawPoint tung diem.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "lcd-seq.h"
+#include "gui-span.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define GUI_SPAN_SWAP(a,b,t)				do{ (t) = (a); (a) = (b); (b) = (t); }while(0)
+
+// Doan dang gom: cac diem lien tiep cung hang (ngang) hoac cung cot (doc)
+typedef struct {
+	int16_t		iXs;
+	int16_t		iYs;
+	int16_t		iXe;
+	int16_t		iYe;
+	uint8_t		byValid;
+}GuiSpanRun_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void guiSpanFill(int16_t iXs,int16_t iYs,int16_t iXe,int16_t iYe,u16 wColor);
+
+static void guiSpanRunPut(GuiSpanRun_t *pRun,int16_t iX,int16_t iY,u16 wColor);
+
+static void guiSpanRunFlush(GuiSpanRun_t *pRun,u16 wColor);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   guiSpanHLine
+ * @brief  Duong ngang: 1 cua so + 1 lan ghi
+ * @param  wXs, wXe, wY: Toa do (wXs, wXe theo thu tu bat ky)
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanHLine(u16 wXs,u16 wXe,u16 wY,u16 wColor)
+{
+	guiSpanFill(wXs, wY, wXe, wY, wColor);
+}
+/**
+ * @func   guiSpanVLine
+ * @brief  Duong doc: 1 cua so + 1 lan ghi
+ * @param  wX, wYs, wYe: Toa do (wYs, wYe theo thu tu bat ky)
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanVLine(u16 wX,u16 wYs,u16 wYe,u16 wColor)
+{
+	guiSpanFill(wX, wYs, wX, wYe, wColor);
+}
+/**
+ * @func   guiSpanLine
+ * @brief  Duong thang Bresenham, cac diem lien tiep cung hang/cot duoc gom
+ *         thanh 1 doan to. Duong ngang/doc chi con 1 lan to
+ * @param  wX1, wY1, wX2, wY2: Hai dau mut (ca hai deu duoc ve)
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanLine(u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor)
+{
+	int16_t iX = wX1;
+	int16_t iY = wY1;
+	int16_t iDx = (wX2 > wX1) ? wX2 - wX1 : wX1 - wX2;
+	int16_t iDy = (wY2 > wY1) ? wY1 - wY2 : wY2 - wY1;
+	int16_t iSx = (wX2 > wX1) ? 1 : -1;
+	int16_t iSy = (wY2 > wY1) ? 1 : -1;
+	int32_t iErr = iDx + iDy;
+	int32_t iErr2;
+	GuiSpanRun_t run = {0};
+
+	if((iDx == 0)||(iDy == 0))
+	{
+		guiSpanFill(wX1, wY1, wX2, wY2, wColor);
+		return;
+	}
+	while(1)
+	{
+		guiSpanRunPut(&run, iX, iY, wColor);
+		if((iX == wX2)&&(iY == wY2))
+		{
+			break;
+		}
+		iErr2 = 2*iErr;
+		if(iErr2 >= iDy)
+		{
+			iErr += iDy;
+			iX += iSx;
+		}
+		if(iErr2 <= iDx)
+		{
+			iErr += iDx;
+			iY += iSy;
+		}
+	}
+	guiSpanRunFlush(&run, wColor);
+}
+/**
+ * @func   guiSpanRect
+ * @brief  Khung chu nhat: 4 doan, khong to trung goc
+ * @param  wX1, wY1, wX2, wY2: Hai goc doi dien
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanRect(u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor)
+{
+	u16 wXs = (wX1 < wX2) ? wX1 : wX2;
+	u16 wXe = (wX1 < wX2) ? wX2 : wX1;
+	u16 wYs = (wY1 < wY2) ? wY1 : wY2;
+	u16 wYe = (wY1 < wY2) ? wY2 : wY1;
+
+	guiSpanFill(wXs, wYs, wXe, wYs, wColor);
+	if(wYe == wYs)
+	{
+		return;
+	}
+	guiSpanFill(wXs, wYe, wXe, wYe, wColor);
+	if(wYe - wYs >= 2)
+	{
+		guiSpanFill(wXs, wYs + 1, wXs, wYe - 1, wColor);
+		if(wXe != wXs)
+		{
+			guiSpanFill(wXe, wYs + 1, wXe, wYe - 1, wColor);
+		}
+	}
+}
+/**
+ * @func   guiSpanFillRect
+ * @brief  To kin chu nhat: 1 cua so + 1 lan ghi
+ * @param  wX1, wY1, wX2, wY2: Hai goc doi dien
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanFillRect(u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor)
+{
+	guiSpanFill(wX1, wY1, wX2, wY2, wColor);
+}
+/**
+ * @func   guiSpanCircle
+ * @brief  Duong tron trung diem. Moi 1/8 cung co 1 doan dang gom rieng: cung
+ *         tren/duoi gom thanh doan ngang, cung trai/phai thanh doan doc
+ * @param  wXc, wYc, wR: Tam va ban kinh
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanCircle(u16 wXc,u16 wYc,u16 wR,u16 wColor)
+{
+	int16_t iF = 1 - wR;
+	int16_t iDdx = 1;
+	int16_t iDdy = -2*wR;
+	int16_t iX = 0;
+	int16_t iY = wR;
+	int16_t iXc = wXc;
+	int16_t iYc = wYc;
+	GuiSpanRun_t pRun[8] = {0};
+
+	guiSpanRunPut(&pRun[0], iXc, iYc + wR, wColor);
+	guiSpanRunPut(&pRun[2], iXc, iYc - wR, wColor);
+	guiSpanRunPut(&pRun[4], iXc + wR, iYc, wColor);
+	guiSpanRunPut(&pRun[6], iXc - wR, iYc, wColor);
+	while(iX < iY)
+	{
+		if(iF >= 0)
+		{
+			iY--;
+			iDdy += 2;
+			iF += iDdy;
+		}
+		iX++;
+		iDdx += 2;
+		iF += iDdx;
+		guiSpanRunPut(&pRun[0], iXc + iX, iYc + iY, wColor);
+		guiSpanRunPut(&pRun[1], iXc - iX, iYc + iY, wColor);
+		guiSpanRunPut(&pRun[2], iXc + iX, iYc - iY, wColor);
+		guiSpanRunPut(&pRun[3], iXc - iX, iYc - iY, wColor);
+		guiSpanRunPut(&pRun[4], iXc + iY, iYc + iX, wColor);
+		guiSpanRunPut(&pRun[5], iXc + iY, iYc - iX, wColor);
+		guiSpanRunPut(&pRun[6], iXc - iY, iYc + iX, wColor);
+		guiSpanRunPut(&pRun[7], iXc - iY, iYc - iX, wColor);
+	}
+	for(uint8_t i = 0; i < 8; i++)
+	{
+		guiSpanRunFlush(&pRun[i], wColor);
+	}
+}
+/**
+ * @func   guiSpanFillCircle
+ * @brief  Hinh tron dac: moi hang 1 doan ngang, bien trung voi guiSpanCircle
+ * @param  wXc, wYc, wR: Tam va ban kinh
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanFillCircle(u16 wXc,u16 wYc,u16 wR,u16 wColor)
+{
+	int16_t iF = 1 - wR;
+	int16_t iDdx = 1;
+	int16_t iDdy = -2*wR;
+	int16_t iX = 0;
+	int16_t iY = wR;
+	int16_t iPx = 0;
+	int16_t iPy = wR;
+	int16_t iXc = wXc;
+	int16_t iYc = wYc;
+
+	guiSpanFill(iXc - wR, iYc, iXc + wR, iYc, wColor);
+	while(iX < iY)
+	{
+		if(iF >= 0)
+		{
+			iY--;
+			iDdy += 2;
+			iF += iDdy;
+		}
+		iX++;
+		iDdx += 2;
+		iF += iDdx;
+		//Hang yc +- x: rong y; bo qua khi trung hang yc +- y da to
+		if(iX < iY + 1)
+		{
+			guiSpanFill(iXc - iY, iYc + iX, iXc + iY, iYc + iX, wColor);
+			guiSpanFill(iXc - iY, iYc - iX, iXc + iY, iYc - iX, wColor);
+		}
+		//Hang yc +- y chi to 1 lan, khi y sap doi (do rong x lon nhat)
+		if(iY != iPy)
+		{
+			guiSpanFill(iXc - iPx, iYc + iPy, iXc + iPx, iYc + iPy, wColor);
+			guiSpanFill(iXc - iPx, iYc - iPy, iXc + iPx, iYc - iPy, wColor);
+			iPy = iY;
+		}
+		iPx = iX;
+	}
+}
+/**
+ * @func   guiSpanTriangle
+ * @brief  Tam giac: 3 canh qua guiSpanLine
+ * @param  wX0..wY2: Ba dinh
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanTriangle(u16 wX0,u16 wY0,u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor)
+{
+	guiSpanLine(wX0, wY0, wX1, wY1, wColor);
+	guiSpanLine(wX1, wY1, wX2, wY2, wColor);
+	guiSpanLine(wX2, wY2, wX0, wY0, wColor);
+}
+/**
+ * @func   guiSpanFillTriangle
+ * @brief  Tam giac dac quet theo hang: moi hang 1 doan ngang
+ * @param  wX0..wY2: Ba dinh
+ * @param  wColor: Mau
+ * @retval None
+ */
+void guiSpanFillTriangle(u16 wX0,u16 wY0,u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor)
+{
+	int32_t iX0 = wX0, iY0 = wY0, iX1 = wX1, iY1 = wY1, iX2 = wX2, iY2 = wY2;
+	int32_t iTemp;
+	int32_t iA, iB, iY, iLast;
+	int32_t iSa = 0, iSb = 0;
+
+	//Sap xep dinh theo y: y0 <= y1 <= y2
+	if(iY0 > iY1)
+	{
+		GUI_SPAN_SWAP(iY0, iY1, iTemp);
+		GUI_SPAN_SWAP(iX0, iX1, iTemp);
+	}
+	if(iY1 > iY2)
+	{
+		GUI_SPAN_SWAP(iY2, iY1, iTemp);
+		GUI_SPAN_SWAP(iX2, iX1, iTemp);
+	}
+	if(iY0 > iY1)
+	{
+		GUI_SPAN_SWAP(iY0, iY1, iTemp);
+		GUI_SPAN_SWAP(iX0, iX1, iTemp);
+	}
+	if(iY0 == iY2) //Suy bien thanh 1 hang
+	{
+		iA = iB = iX0;
+		iA = (iX1 < iA) ? iX1 : iA;
+		iB = (iX1 > iB) ? iX1 : iB;
+		iA = (iX2 < iA) ? iX2 : iA;
+		iB = (iX2 > iB) ? iX2 : iB;
+		guiSpanFill(iA, iY0, iB, iY0, wColor);
+		return;
+	}
+	//Nua tren (y0..y1, gom hang y1 neu canh duoi nam ngang), roi nua duoi
+	iLast = (iY1 == iY2) ? iY1 : iY1 - 1;
+	for(iY = iY0; iY <= iLast; iY++)
+	{
+		iA = iX0 + iSa / (iY1 - iY0);
+		iB = iX0 + iSb / (iY2 - iY0);
+		iSa += iX1 - iX0;
+		iSb += iX2 - iX0;
+		guiSpanFill(iA, iY, iB, iY, wColor);
+	}
+	iSa = (iX2 - iX1) * (iY - iY1);
+	iSb = (iX2 - iX0) * (iY - iY0);
+	for(; iY <= iY2; iY++)
+	{
+		iA = iX1 + iSa / (iY2 - iY1);
+		iB = iX0 + iSb / (iY2 - iY0);
+		iSa += iX2 - iX1;
+		iSb += iX2 - iX0;
+		guiSpanFill(iA, iY, iB, iY, wColor);
+	}
+}
+/**
+ * @func   guiSpanFill
+ * @brief  To 1 vung (toa do theo thu tu bat ky), cat phan am
+ * @param
+ * @retval None
+ */
+static void guiSpanFill(int16_t iXs,int16_t iYs,int16_t iXe,int16_t iYe,u16 wColor)
+{
+	int16_t iTemp;
+
+	if(iXs > iXe)
+	{
+		iTemp = iXs;
+		iXs = iXe;
+		iXe = iTemp;
+	}
+	if(iYs > iYe)
+	{
+		iTemp = iYs;
+		iYs = iYe;
+		iYe = iTemp;
+	}
+	if((iXe < 0)||(iYe < 0))
+	{
+		return;
+	}
+	LCD_SeqFill((iXs < 0) ? 0 : iXs, (iYs < 0) ? 0 : iYs, iXe, iYe, wColor);
+}
+/**
+ * @func   guiSpanRunPut
+ * @brief  Them 1 diem vao doan dang gom; diem lien ke cung hang/cot thi keo
+ *         dai doan, neu khong to doan cu va bat dau doan moi
+ * @param
+ * @retval None
+ */
+static void guiSpanRunPut(GuiSpanRun_t *pRun,int16_t iX,int16_t iY,u16 wColor)
+{
+	if(pRun->byValid)
+	{
+		if((iY == pRun->iYs)&&(iY == pRun->iYe))
+		{
+			if(iX == pRun->iXe + 1)
+			{
+				pRun->iXe = iX;
+				return;
+			}
+			if(iX + 1 == pRun->iXs)
+			{
+				pRun->iXs = iX;
+				return;
+			}
+			if((iX >= pRun->iXs)&&(iX <= pRun->iXe))
+			{
+				return;
+			}
+		}
+		if((iX == pRun->iXs)&&(iX == pRun->iXe))
+		{
+			if(iY == pRun->iYe + 1)
+			{
+				pRun->iYe = iY;
+				return;
+			}
+			if(iY + 1 == pRun->iYs)
+			{
+				pRun->iYs = iY;
+				return;
+			}
+			if((iY >= pRun->iYs)&&(iY <= pRun->iYe))
+			{
+				return;
+			}
+		}
+		guiSpanRunFlush(pRun, wColor);
+	}
+	pRun->iXs = pRun->iXe = iX;
+	pRun->iYs = pRun->iYe = iY;
+	pRun->byValid = 1;
+}
+/**
+ * @func   guiSpanRunFlush
+ * @brief  To doan dang gom
+ * @param
+ * @retval None
+ */
+static void guiSpanRunFlush(GuiSpanRun_t *pRun,u16 wColor)
+{
+	if(pRun->byValid)
+	{
+		guiSpanFill(pRun->iXs, pRun->iYs, pRun->iXe, pRun->iYe, wColor);
+		pRun->byValid = 0;
+	}
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: gui-span.h
+ *
+ * Description: Ve duong/hinh bang doan to (span): moi doan ngang/doc la 1 cua so
+ *              + 1 lan ghi lien tuc qua LCD_SeqFill thay vi LCD_DrawPoint tung diem.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _GUI_SPAN_H_
+#define _GUI_SPAN_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "lcd.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void guiSpanHLine(u16 wXs,u16 wXe,u16 wY,u16 wColor);
+
+void guiSpanVLine(u16 wX,u16 wYs,u16 wYe,u16 wColor);
+
+void guiSpanLine(u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor);
+
+void guiSpanRect(u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor);
+
+void guiSpanFillRect(u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor);
+
+void guiSpanCircle(u16 wXc,u16 wYc,u16 wR,u16 wColor);
+
+void guiSpanFillCircle(u16 wXc,u16 wYc,u16 wR,u16 wColor);
+
+void guiSpanTriangle(u16 wX0,u16 wY0,u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor);
+
+void guiSpanFillTriangle(u16 wX0,u16 wY0,u16 wX1,u16 wY1,u16 wX2,u16 wY2,u16 wColor);
+
+#endif
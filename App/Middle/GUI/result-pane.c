@@ -0,0 +1,513 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: result-pane.c
+ *
+ * Description: Man hinh ket qua chia theo kenh DUT: moi kenh 1 o (pane) rieng
+ *              co tieu de, ma QR, MAC va cac truong version/PID cua DUT vua
+ *              test. Ve qua display-list va lcd-seq.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "qrcode.h"
+#include "lcd-seq.h"
+#include "str-builder.h"
+#include "scratch-arena.h"
+#include "result-pane.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// Vi tri trong o, tinh tu dinh o (wY)
+#define RP_HEADER_Y							2
+#define RP_STATUS_X							52
+#define RP_BOX_XS							220		//O mau DAT/LOI o tieu de
+#define RP_BOX_XE							235
+#define RP_QR_PX(pPane)						RESULT_PANE_QR_PX((pPane)->byQrScale)
+#define RP_COL_X(pPane)						(RP_QR_PX(pPane) + 3)	//Cot ben phai ma QR
+#define RP_COL_VALUE_DX						48
+#define RP_ROW_Y							22
+#define RP_ROW_STEP							14
+#define RP_MAC_MIN_Y						114		//Duoi 6 dong cua cot phai
+#define RP_MAC_Y(pPane)						((RESULT_PANE_QR_Y + RP_QR_PX(pPane) + 2 > RP_MAC_MIN_Y) ? \
+											 (RESULT_PANE_QR_Y + RP_QR_PX(pPane) + 2) : RP_MAC_MIN_Y)
+#define RP_MODEL_DY							17
+#define RP_FAIL_MSG_Y						24
+#define RP_FAIL_ROW_Y						44
+#define RP_FAIL_ROW_STEP					20
+
+// Truong hien thi theo che do test
+#define RP_SHOW_ALL							0x00
+#define RP_SHOW_ZIGBEE						0x01
+#define RP_SHOW_BLE							0x02
+
+#define RP_LAYOUT_NONE						0x00
+#define RP_LAYOUT_FAIL						0x80	//| RP_SHOW_xxx
+
+typedef struct {
+	const char	*pcLabel;
+	uint8_t		byField;
+	uint8_t		byShow;
+}RpRow_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+// Cot ben phai ma QR, co chu 12
+static const RpRow_t g_pRpRow[] = {
+	{"Button :",	RESULT_FIELD_BUTTON,		RP_SHOW_ALL},
+	{"Ver ZB :",	RESULT_FIELD_VER_ZIGBEE,	RP_SHOW_ZIGBEE},
+	{"Ver BLE:",	RESULT_FIELD_VER_BLE,		RP_SHOW_BLE},
+	{"PID    :",	RESULT_FIELD_PID,			RP_SHOW_BLE},
+	{"Ver MCU:",	RESULT_FIELD_VER_MCU,		RP_SHOW_ALL},
+	{"Type   :",	RESULT_FIELD_TYPE_MCU,		RP_SHOW_ALL},
+};
+
+// Bo cuc loi, co chu 16
+static const RpRow_t g_pRpFailRow[] = {
+	{"Button     :",	RESULT_FIELD_BUTTON,		RP_SHOW_ALL},
+	{"Button Zgb :",	RESULT_FIELD_BUTTON_ZIGBEE,	RP_SHOW_ZIGBEE},
+	{"Button BLE :",	RESULT_FIELD_BUTTON_BLE,	RP_SHOW_BLE},
+};
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t resultPaneShowMask(TestSwMode_e mode);
+
+static void resultPaneRecordPass(ResultPane_t *pPane,uint8_t byShow);
+
+static void resultPaneRecordFail(ResultPane_t *pPane,uint8_t byShow,const char *pcMsg);
+
+static void resultPaneRecordHeader(ResultPane_t *pPane);
+
+static void resultPaneReplay(ResultPane_t *pPane,const DutSession_t *pSess,uint64_t qwMAC,
+		const char *pcStatus,u16 wStatusColor);
+
+static void resultPaneDrawQr(const ResultPane_t *pPane,const char *pcData);
+
+static void formatVersion(char *pOutPut,uint16_t wSize,uint32_t dwVersion,uint8_t byReceived);
+
+static void sbAppendRxField(StrBuilder_t *pSb,const DutSession_t *pSess,uint8_t byFlag,uint64_t qwValue,uint8_t byBytes);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   resultPaneInit
+ * @brief  Khoi tao o ket qua cua 1 kenh; o thu n nam ngay duoi o n-1
+ * @param  pPane: O ket qua
+ * @param  byChannel: Kenh DUT, o so byChannel
+ * @retval None
+ */
+void resultPaneInit(ResultPane_t *pPane,uint8_t byChannel)
+{
+	pPane->byChannel = byChannel;
+	resultPaneSetArea(pPane, RESULT_PANE_Y0 + byChannel * RESULT_PANE_HEIGHT, RESULT_PANE_HEIGHT);
+	pPane->pcTitle[0] = 'D';
+	pPane->pcTitle[1] = 'U';
+	pPane->pcTitle[2] = 'T';
+	pPane->pcTitle[3] = ' ';
+	pPane->pcTitle[4] = '1' + byChannel;
+	pPane->pcTitle[5] = 0;
+}
+/**
+ * @func   resultPaneSetArea
+ * @brief  Dat vi tri va chieu cao o (nua man hinh hoac ca man hinh); o cao tu
+ *         RESULT_PANE_FULL_HEIGHT thi ve ma QR to hon. Lan ve sau ghi lai bo
+ *         cuc; vung cu khong duoc xoa
+ * @param  pPane: O ket qua
+ * @param  wY: Dong tren cung cua o
+ * @param  wHeight: Chieu cao o
+ * @retval None
+ */
+void resultPaneSetArea(ResultPane_t *pPane,u16 wY,u16 wHeight)
+{
+	pPane->wY = wY;
+	pPane->wHeight = wHeight;
+	pPane->byQrScale = (wHeight >= RESULT_PANE_FULL_HEIGHT) ? RESULT_PANE_QR_SCALE_FULL : RESULT_PANE_QR_SCALE_SPLIT;
+	pPane->byLayout = RP_LAYOUT_NONE;
+	pPane->pcFailMsg = NULL;
+	dlInit(&pPane->dl, pPane->pCmd, RESULT_PANE_MAX_CMD, BLACK, WHITE);
+}
+/**
+ * @func   resultPaneInvalidate
+ * @brief  Danh dau o da bi ve de len (logo, menu); lan sau ve lai ca o
+ * @param  pPane: O ket qua
+ * @retval None
+ */
+void resultPaneInvalidate(ResultPane_t *pPane)
+{
+	dlInvalidate(&pPane->dl);
+}
+/**
+ * @func   resultPaneShowPass
+ * @brief  Ve DUT dat vao o cua kenh: ma QR, MAC va cac truong theo che do.
+ *         Cung bo cuc voi lan truoc thi chi ve lai ky tu doi va ma QR
+ * @param  pPane: O ket qua
+ * @param  pSess: Phien test cua kenh
+ * @param  mode: Che do test
+ * @param  byDeviceType: Loai thiet bi trong ban tin vua nhan
+ * @retval None
+ */
+void resultPaneShowPass(ResultPane_t *pPane,const DutSession_t *pSess,TestSwMode_e mode,uint8_t byDeviceType)
+{
+	ScratchMark_t scratchScope = scratchMark();
+	uint8_t byShow = resultPaneShowMask(mode);
+	uint64_t qwMAC = (mode == BLE_MODE) ? pSess->qwMACBle : pSess->qwMACZigbee;
+	char *pcData;
+
+	if(pPane->byLayout != byShow)
+	{
+		resultPaneRecordPass(pPane, byShow);
+	}
+	resultPaneReplay(pPane, pSess, qwMAC, "PASS", GREEN);
+
+	//Chuoi QR lay tu vung nho tam, tra lai cuoi ham
+	pcData = scratchAlloc(RESULT_PANE_QR_DATA_SIZE);
+	if(pcData != NULL)
+	{
+		resultPaneQrData(pcData, RESULT_PANE_QR_DATA_SIZE, pSess, mode, byDeviceType);
+		resultPaneDrawQr(pPane, pcData);
+	}
+	scratchRelease(scratchScope);
+}
+/**
+ * @func   resultPaneShowFail
+ * @brief  Ve DUT loi vao o cua kenh: thong bao, MAC va so nut MCU/ZigBee/BLE
+ * @param  pPane: O ket qua
+ * @param  pSess: Phien test cua kenh
+ * @param  mode: Che do test
+ * @param  event: DUT_EVENT_FAIL_xxx
+ * @retval None
+ */
+void resultPaneShowFail(ResultPane_t *pPane,const DutSession_t *pSess,TestSwMode_e mode,DutEvent_e event)
+{
+	uint8_t byShow = resultPaneShowMask(mode);
+	const char *pcMsg;
+	const char *pcStatus;
+
+	switch(event)
+	{
+	case DUT_EVENT_FAIL_BLE:
+		pcMsg = "Firmware BLE ERROR!!!";
+		pcStatus = "FAIL BLE";
+		break;
+	case DUT_EVENT_FAIL_BOTH:
+		pcMsg = "Firmware ZB+BLE ERROR!!!";
+		pcStatus = "FAIL ZB+BLE";
+		break;
+	default:
+		pcMsg = "Firmware ZigBee ERROR!!!";
+		pcStatus = "FAIL ZigBee";
+		break;
+	}
+	if(mode != DUAL_MODE)
+	{
+		pcMsg = "Firmware ERROR!!!";
+	}
+
+	if((pPane->byLayout != (RP_LAYOUT_FAIL | byShow))||(pPane->pcFailMsg != pcMsg))
+	{
+		resultPaneRecordFail(pPane, byShow, pcMsg);
+	}
+	resultPaneReplay(pPane, pSess, (mode == BLE_MODE) ? pSess->qwMACBle : pSess->qwMACZigbee,
+			pcStatus, RED);
+}
+/**
+ * @func   resultPaneQrData
+ * @brief  Ghep thong tin DUT dat vao chuoi QR: MAC,type[,PID][,verZB][,verBLE]
+ *         theo che do test; truong chua nhan de trong
+ * @param  pOutPut, wSize: Chuoi ket qua, toi thieu RESULT_PANE_QR_DATA_SIZE
+ * @param  pSess: Phien test cua kenh
+ * @param  mode: Che do test
+ * @param  byDeviceType: Loai thiet bi
+ * @retval Do dai chuoi
+ */
+uint16_t resultPaneQrData(char *pOutPut,uint16_t wSize,const DutSession_t *pSess,TestSwMode_e mode,uint8_t byDeviceType)
+{
+	StrBuilder_t sbData;
+
+	sbInit(&sbData, pOutPut, wSize);
+	sbAppendHexValue(&sbData, (mode == BLE_MODE) ? pSess->qwMACBle : pSess->qwMACZigbee, LENGTH_OF_MAC, 0);
+	sbAppendChar(&sbData, ',');
+	sbAppendHexValue(&sbData, byDeviceType, LENGTH_OF_DEVICE_TYPE, 0);
+	if(mode != ZIGBEE_MODE)
+	{
+		sbAppendChar(&sbData, ',');
+		sbAppendRxField(&sbData, pSess, SESS_RX_PID, pSess->wPID, LENGTH_OF_PID);
+	}
+	if(mode != BLE_MODE)
+	{
+		sbAppendChar(&sbData, ',');
+		sbAppendRxField(&sbData, pSess, SESS_RX_VER_ZIGBEE, pSess->dwVersionZigBee, LENGTH_OF_VERSION);
+	}
+	if(mode != ZIGBEE_MODE)
+	{
+		sbAppendChar(&sbData, ',');
+		sbAppendRxField(&sbData, pSess, SESS_RX_VER_BLE, pSess->dwVersionBluetooth, LENGTH_OF_VERSION);
+	}
+	return sbData.wLen;
+}
+/**
+ * @func   resultPaneShowMask
+ * @brief  Cac truong can hien thi cua che do test
+ * @param  mode: Che do test
+ * @retval Cac bit RP_SHOW_xxx
+ */
+static uint8_t resultPaneShowMask(TestSwMode_e mode)
+{
+	switch(mode)
+	{
+	case ZIGBEE_MODE:
+		return RP_SHOW_ZIGBEE;
+	case BLE_MODE:
+		return RP_SHOW_BLE;
+	default:
+		return RP_SHOW_ZIGBEE | RP_SHOW_BLE;
+	}
+}
+/**
+ * @func   resultPaneRecordHeader
+ * @brief  Ghi duong ke tren cung va tieu de "DUT n  <ket qua>" cua o; goi
+ *         sau cac CLEAR vi lenh ghi sau ve de len lenh ghi truoc
+ * @param  pPane: O ket qua
+ * @retval None
+ */
+static void resultPaneRecordHeader(ResultPane_t *pPane)
+{
+	DisplayList_t *pDl = &pPane->dl;
+
+	dlRecordHLine(pDl, 0, lcddev.width - 1, pPane->wY);
+	dlRecordText(pDl, 4, pPane->wY + RP_HEADER_Y, pPane->pcTitle, 16);
+	dlRecordField(pDl, RP_STATUS_X, pPane->wY + RP_HEADER_Y, RESULT_FIELD_STATUS, 16);
+}
+/**
+ * @func   resultPaneRecordPass
+ * @brief  Ghi bo cuc o DUT dat. Vung ma QR khong nam trong CLEAR nao vi
+ *         resultPaneDrawQr ve de het vung do
+ * @param  pPane: O ket qua
+ * @param  byShow: Cac bit RP_SHOW_xxx
+ * @retval None
+ */
+static void resultPaneRecordPass(ResultPane_t *pPane,uint8_t byShow)
+{
+	DisplayList_t *pDl = &pPane->dl;
+	u16 wY = pPane->wY;
+	u16 wRowY = wY + RP_ROW_Y;
+	u16 wQrPx = RP_QR_PX(pPane);
+
+	dlInit(pDl, pPane->pCmd, RESULT_PANE_MAX_CMD, BLACK, WHITE);
+	dlRecordClear(pDl, 0, wY + 1, lcddev.width - 1, wY + RESULT_PANE_QR_Y - 1);
+	dlRecordClear(pDl, wQrPx, wY + RESULT_PANE_QR_Y, lcddev.width - 1,
+			wY + RESULT_PANE_QR_Y + wQrPx - 1);
+	dlRecordClear(pDl, 0, wY + RESULT_PANE_QR_Y + wQrPx, lcddev.width - 1,
+			wY + pPane->wHeight - 1);
+	resultPaneRecordHeader(pPane);
+	for(uint8_t i = 0; i < sizeof(g_pRpRow) / sizeof(g_pRpRow[0]); i++)
+	{
+		if((g_pRpRow[i].byShow == RP_SHOW_ALL)||(g_pRpRow[i].byShow & byShow))
+		{
+			dlRecordText(pDl, RP_COL_X(pPane), wRowY, g_pRpRow[i].pcLabel, 12);
+			dlRecordField(pDl, RP_COL_X(pPane) + RP_COL_VALUE_DX, wRowY, g_pRpRow[i].byField, 12);
+			wRowY += RP_ROW_STEP;
+		}
+	}
+	dlRecordText(pDl, 4, wY + RP_MAC_Y(pPane), "MAC ", 16);
+	dlRecordField(pDl, 36, wY + RP_MAC_Y(pPane), RESULT_FIELD_MAC, 16);
+	if(byShow & RP_SHOW_ZIGBEE)
+	{
+		dlRecordText(pDl, 4, wY + RP_MAC_Y(pPane) + RP_MODEL_DY, "Model ", 16);
+		dlRecordField(pDl, 52, wY + RP_MAC_Y(pPane) + RP_MODEL_DY, RESULT_FIELD_MODEL_ID, 16);
+	}
+	pPane->byLayout = byShow;
+}
+/**
+ * @func   resultPaneRecordFail
+ * @brief  Ghi bo cuc o DUT loi
+ * @param  pPane: O ket qua
+ * @param  byShow: Cac bit RP_SHOW_xxx
+ * @param  pcMsg: Thong bao loi (chuoi hang)
+ * @retval None
+ */
+static void resultPaneRecordFail(ResultPane_t *pPane,uint8_t byShow,const char *pcMsg)
+{
+	DisplayList_t *pDl = &pPane->dl;
+	u16 wY = pPane->wY;
+	u16 wRowY = wY + RP_FAIL_ROW_Y + RP_FAIL_ROW_STEP;
+
+	dlInit(pDl, pPane->pCmd, RESULT_PANE_MAX_CMD, BLACK, WHITE);
+	dlRecordClear(pDl, 0, wY + 1, lcddev.width - 1, wY + pPane->wHeight - 1);
+	resultPaneRecordHeader(pPane);
+	dlRecordText(pDl, 4, wY + RP_FAIL_MSG_Y, pcMsg, 16);
+	dlRecordText(pDl, 4, wY + RP_FAIL_ROW_Y, "MAC ", 16);
+	dlRecordField(pDl, 36, wY + RP_FAIL_ROW_Y, RESULT_FIELD_MAC, 16);
+	for(uint8_t i = 0; i < sizeof(g_pRpFailRow) / sizeof(g_pRpFailRow[0]); i++)
+	{
+		if((g_pRpFailRow[i].byShow == RP_SHOW_ALL)||(g_pRpFailRow[i].byShow & byShow))
+		{
+			dlRecordText(pDl, 4, wRowY, g_pRpFailRow[i].pcLabel, 16);
+			dlRecordField(pDl, 100, wRowY, g_pRpFailRow[i].byField, 16);
+			wRowY += RP_FAIL_ROW_STEP;
+		}
+	}
+	pPane->byLayout = RP_LAYOUT_FAIL | byShow;
+	pPane->pcFailMsg = pcMsg;
+}
+/**
+ * @func   resultPaneReplay
+ * @brief  Dinh dang cac truong gia tri, phat lai bo cuc va to o mau ket qua
+ * @param  pPane: O ket qua
+ * @param  pSess: Phien test cua kenh
+ * @param  qwMAC: MAC 64 bit
+ * @param  pcStatus: Chuoi ket qua o tieu de
+ * @param  wStatusColor: Mau o ket qua
+ * @retval None
+ */
+static void resultPaneReplay(ResultPane_t *pPane,const DutSession_t *pSess,uint64_t qwMAC,
+		const char *pcStatus,u16 wStatusColor)
+{
+	char pstrMAC[LENGTH_OF_MAC * 3];
+	char pstrButton[3];
+	char pstrButtonZigbee[3];
+	char pstrButtonBle[3];
+	char pstrVerZigbee[LENGTH_OF_VERSION * 3];
+	char pstrVerBle[LENGTH_OF_VERSION * 3];
+	char pstrVerMCU[LENGTH_OF_VERSION * 3];
+	char pstrTypeMCU[3];
+	char pstrPID[LENGTH_OF_PID * 2 + 1] = {0};
+	const char *ppField[RESULT_FIELD_CNT];
+	StrBuilder_t sbTemp;
+
+	sbInit(&sbTemp, pstrMAC, sizeof(pstrMAC));
+	sbAppendHexValue(&sbTemp, qwMAC, LENGTH_OF_MAC, ':');
+	strHexEncode(pstrButton, &pSess->byEndpointCntMCU, 1);
+	strHexEncode(pstrButtonZigbee, &pSess->byEndpointCntZigBee, 1);
+	strHexEncode(pstrButtonBle, &pSess->byEndpointCntBLE, 1);
+	formatVersion(pstrVerZigbee, sizeof(pstrVerZigbee), pSess->dwVersionZigBee,
+			pSess->byFieldRx & SESS_RX_VER_ZIGBEE);
+	formatVersion(pstrVerBle, sizeof(pstrVerBle), pSess->dwVersionBluetooth,
+			pSess->byFieldRx & SESS_RX_VER_BLE);
+	formatVersion(pstrVerMCU, sizeof(pstrVerMCU), pSess->dwVersionMCU,
+			pSess->byFieldRx & SESS_RX_VER_MCU);
+	strHexEncode(pstrTypeMCU, &pSess->byTypeMCU, 1);
+	if(pSess->byFieldRx & SESS_RX_PID)
+	{
+		sbInit(&sbTemp, pstrPID, sizeof(pstrPID));
+		sbAppendHexValue(&sbTemp, pSess->wPID, LENGTH_OF_PID, 0);
+	}
+
+	ppField[RESULT_FIELD_MAC] = pstrMAC;
+	ppField[RESULT_FIELD_BUTTON] = pstrButton;
+	ppField[RESULT_FIELD_VER_ZIGBEE] = pstrVerZigbee;
+	ppField[RESULT_FIELD_MODEL_ID] = pSess->pcModelID;
+	ppField[RESULT_FIELD_VER_BLE] = pstrVerBle;
+	ppField[RESULT_FIELD_PID] = pstrPID;
+	ppField[RESULT_FIELD_VER_MCU] = pstrVerMCU;
+	ppField[RESULT_FIELD_TYPE_MCU] = pstrTypeMCU;
+	ppField[RESULT_FIELD_STATUS] = pcStatus;
+	ppField[RESULT_FIELD_BUTTON_ZIGBEE] = pstrButtonZigbee;
+	ppField[RESULT_FIELD_BUTTON_BLE] = pstrButtonBle;
+
+	dlReplay(&pPane->dl, ppField);
+	LCD_SeqFill(RP_BOX_XS, pPane->wY + RP_HEADER_Y + 1, RP_BOX_XE, pPane->wY + RP_HEADER_Y + 14, wStatusColor);
+}
+/**
+ * @func   resultPaneDrawQr
+ * @brief  Ve ma QR (ca le trang 4 module) vao goc trai o theo dong quet: moi
+ *         dong diem anh ghep 1 lan roi gui bang DMA, thay cho ve tung diem qua
+ *         GUI_DrawPoint. Chuoi qua dai thi de trang vung QR
+ * @param  pPane: O ket qua
+ * @param  pcData: Chuoi QR (ket thuc 0)
+ * @retval None
+ */
+static void resultPaneDrawQr(const ResultPane_t *pPane,const char *pcData)
+{
+	QRCode qrcode;
+	uint8_t *pbyModules = scratchAlloc(qrcode_getBufferSize(RESULT_PANE_QR_VERSION));
+	uint8_t byOk = (pbyModules != NULL) && (strlen(pcData) <= RESULT_PANE_QR_MAX_LEN) && \
+				   (qrcode_initText(&qrcode, pbyModules, RESULT_PANE_QR_VERSION, ECC_LOW, pcData) == 0);
+	u16 wYs = pPane->wY + RESULT_PANE_QR_Y;
+	u16 wQrPx = RP_QR_PX(pPane);
+	u16 wColor;
+	u8 *pbyLine;
+	int16_t iMx, iMy;
+
+	LCD_SeqLineBegin(0, wYs, wQrPx - 1, wYs + wQrPx - 1);
+	for(u16 y = 0; y < wQrPx; y++)
+	{
+		pbyLine = LCD_SeqLineGet();
+		iMy = y / pPane->byQrScale - RESULT_PANE_QR_QUIET;
+		for(u16 x = 0; x < wQrPx; x++)
+		{
+			iMx = x / pPane->byQrScale - RESULT_PANE_QR_QUIET;
+			wColor = WHITE;
+			if(byOk && (iMx >= 0) && (iMy >= 0) && (iMx < qrcode.size) && (iMy < qrcode.size) && \
+					qrcode_getModule(&qrcode, iMx, iMy))
+			{
+				wColor = BLACK;
+			}
+			pbyLine[2*x] = wColor >> 8;
+			pbyLine[2*x + 1] = wColor;
+		}
+		LCD_SeqLinePut(wQrPx * 2);
+	}
+	LCD_SeqLineEnd();
+}
+/**
+ * @func   formatVersion
+ * @brief  Doi version dong goi sang "MM.mm.pp" (ke ca 00.00.00); chua nhan
+ *         hoac da xoa thi thanh chuoi rong
+ * @param  pOutPut, wSize: Chuoi ket qua, toi thieu LENGTH_OF_VERSION*3 byte
+ * @param  dwVersion: Version dong goi
+ * @param  byReceived: Khac 0 neu da nhan version tu DUT
+ * @retval None
+ */
+static void formatVersion(char *pOutPut,uint16_t wSize,uint32_t dwVersion,uint8_t byReceived)
+{
+	StrBuilder_t sbTemp;
+
+	sbInit(&sbTemp, pOutPut, wSize);
+	if(byReceived)
+	{
+		sbAppendHexValue(&sbTemp, dwVersion, LENGTH_OF_VERSION, '.');
+	}
+}
+/**
+ * @func   sbAppendRxField
+ * @brief  Ghep truong hex vao du lieu QR neu da nhan tu DUT; chua nhan thi de
+ *         trong (giu dau ',' phan cach) nhu ban dau
+ * @param  pSb: Chuoi QR
+ * @param  pSess: Phien DUT
+ * @param  byFlag: Bit SESS_RX_xxx cua truong
+ * @param  qwValue, byBytes: Gia tri va so byte can in
+ * @retval None
+ */
+static void sbAppendRxField(StrBuilder_t *pSb,const DutSession_t *pSess,uint8_t byFlag,uint64_t qwValue,uint8_t byBytes)
+{
+	if(pSess->byFieldRx & byFlag)
+	{
+		sbAppendHexValue(pSb, qwValue, byBytes, 0);
+	}
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: result-pane.h
+ *
+ * Description: Man hinh ket qua chia theo kenh DUT: moi kenh 1 o (pane) rieng
+ *              co tieu de, ma QR, MAC va cac truong version/PID cua DUT vua
+ *              test. Ve qua display-list va lcd-seq.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _RESULT_PANE_H_
+#define _RESULT_PANE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "display-list.h"
+#include "dut-session.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// 2 o xep doc duoi thanh tieu de (0..20) cua man hinh doc 240x320; khi chi
+// 1 kenh co DUT thi o cua kenh do chiem ca vung RESULT_PANE_FULL_HEIGHT
+#define RESULT_PANE_CNT						2
+#define RESULT_PANE_Y0						22
+#define RESULT_PANE_HEIGHT					149
+#define RESULT_PANE_FULL_HEIGHT				(RESULT_PANE_CNT * RESULT_PANE_HEIGHT)
+#define RESULT_PANE_MAX_CMD					24
+
+// Ma QR trong o: version 3 (29x29), ECC thap chua duoc 53 byte, le trang 4
+// module theo chuan QR. O nua man hinh moi module 2x2 diem anh, ca man hinh 3x3
+#define RESULT_PANE_QR_VERSION				3
+#define RESULT_PANE_QR_MODULES				(17 + 4*RESULT_PANE_QR_VERSION)
+#define RESULT_PANE_QR_MAX_LEN				53
+#define RESULT_PANE_QR_QUIET				4
+#define RESULT_PANE_QR_SCALE_SPLIT			2
+#define RESULT_PANE_QR_SCALE_FULL			3
+#define RESULT_PANE_QR_PX(scale)			((RESULT_PANE_QR_MODULES + 2*RESULT_PANE_QR_QUIET) * (scale))
+#define RESULT_PANE_QR_Y					20		//Tinh tu dinh o
+
+// Chuoi QR: MAC,type,PID,verZB,verBLE dang hex va dau phan cach
+#define RESULT_PANE_QR_DATA_SIZE			(5+(LENGTH_OF_MAC+LENGTH_OF_VERSION*2 +LENGTH_OF_PID \
+											+ LENGTH_OF_DEVICE_TYPE)*2)
+
+// Truong gia tri tren o ket qua
+typedef enum {
+	RESULT_FIELD_MAC			= 0x00,
+	RESULT_FIELD_BUTTON			= 0x01,
+	RESULT_FIELD_VER_ZIGBEE		= 0x02,
+	RESULT_FIELD_MODEL_ID		= 0x03,
+	RESULT_FIELD_VER_BLE		= 0x04,
+	RESULT_FIELD_PID			= 0x05,
+	RESULT_FIELD_VER_MCU		= 0x06,
+	RESULT_FIELD_TYPE_MCU		= 0x07,
+	RESULT_FIELD_STATUS			= 0x08,
+	RESULT_FIELD_BUTTON_ZIGBEE	= 0x09,
+	RESULT_FIELD_BUTTON_BLE		= 0x0A,
+	RESULT_FIELD_CNT
+}ResultField_e;
+
+typedef struct {
+	DisplayList_t	dl;
+	DlCmd_t			pCmd[RESULT_PANE_MAX_CMD];
+	u16				wY;					//Dong tren cung cua o
+	u16				wHeight;
+	uint8_t			byQrScale;			//RESULT_PANE_QR_SCALE_xxx theo chieu cao o
+	uint8_t			byChannel;
+	uint8_t			byLayout;			//Bo cuc dang ghi trong dl
+	const char		*pcFailMsg;			//Thong bao cua bo cuc loi dang ghi
+	char			pcTitle[6];			//"DUT n"
+}ResultPane_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void resultPaneInit(ResultPane_t *pPane,uint8_t byChannel);
+
+void resultPaneSetArea(ResultPane_t *pPane,u16 wY,u16 wHeight);
+
+void resultPaneInvalidate(ResultPane_t *pPane);
+
+void resultPaneShowPass(ResultPane_t *pPane,const DutSession_t *pSess,TestSwMode_e mode,uint8_t byDeviceType);
+
+void resultPaneShowFail(ResultPane_t *pPane,const DutSession_t *pSess,TestSwMode_e mode,DutEvent_e event);
+
+uint16_t resultPaneQrData(char *pOutPut,uint16_t wSize,const DutSession_t *pSess,TestSwMode_e mode,uint8_t byDeviceType);
+
+#endif
@@ -0,0 +1,472 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: lcd-seq.c
+ *
+ * Description: Gui lenh LCD kem tham so trong 1 lan giu CS, luu cua so hien tai
+ *              de bo qua lenh dat cua so trung lap.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stddef.h>
+#include "lcd.h"
+#include "spi.h"
+#include "delay.h"
+#include "swar-kernels.h"
+#include "ram-func.h"
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_dma.h"
+#include "stm32f401re_spi.h"
+#include "lcd-seq.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LCD_SEQ_SPI							SPI1
+// SPI1_TX: DMA2 Stream3 Channel3
+#define LCD_SEQ_DMA_STREAM					DMA2_Stream3
+#define LCD_SEQ_DMA_CHANNEL					DMA_Channel_3
+#define LCD_SEQ_DMA_FLAG_TC					DMA_FLAG_TCIF3
+#define LCD_SEQ_DMA_FLAG_ALL				(DMA_FLAG_TCIF3 | DMA_FLAG_HTIF3 | DMA_FLAG_TEIF3 | \
+											 DMA_FLAG_DMEIF3 | DMA_FLAG_FEIF3)
+// So diem toi thieu de dung DMA khi to mau
+#define LCD_SEQ_DMA_MIN_PIXELS				32
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+// Cua so dang duoc dat tren LCD, chi hop le khi byWinValid = 1
+static uint8_t byWinValid = 0;
+static u16 pwWin[4] = {0};
+
+// 2 bo dem dong: CPU ghi dong N+1 trong khi DMA gui dong N
+static u8 pbyLineBuf[2][LCD_SEQ_LINE_MAX] __attribute__((aligned(4)));
+static uint8_t byLineIdx = 0;
+static uint8_t byDmaBusy = 0;
+
+// Trinh tu khoi tao ILI9341 3.2inch, giong LCD_Init trong lcd.c
+static const u8 pbyIli9341Init[] = {
+	0xCF, 3, 0x00, 0xD9, 0x30,
+	0xED, 4, 0x64, 0x03, 0x12, 0x81,
+	0xE8, 3, 0x85, 0x10, 0x7A,
+	0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+	0xF7, 1, 0x20,
+	0xEA, 2, 0x00, 0x00,
+	0xC0, 1, 0x1B,						//Power control
+	0xC1, 1, 0x12,						//Power control
+	0xC5, 2, 0x26, 0x26,				//VCM control
+	0xC7, 1, 0xB0,						//VCM control2
+	0x36, 1, 0x08,						//Memory Access Control
+	0x3A, 1, 0x55,
+	0xB1, 2, 0x00, 0x1A,
+	0xB6, 2, 0x0A, 0xA2,				//Display Function Control
+	0xF2, 1, 0x00,						//3Gamma Function Disable
+	0x26, 1, 0x01,						//Gamma curve selected
+	0xE0, 15, 0x1F, 0x24, 0x24, 0x0D, 0x12, 0x09, 0x52, 0xB7,
+			  0x3F, 0x0C, 0x15, 0x06, 0x0E, 0x08, 0x00,
+	0xE1, 15, 0x00, 0x1B, 0x1B, 0x02, 0x0E, 0x06, 0x2E, 0x48,
+			  0x3F, 0x03, 0x0A, 0x09, 0x31, 0x37, 0x1F,
+	0x2B, 4, 0x00, 0x00, 0x01, 0x3F,
+	0x2A, 4, 0x00, 0x00, 0x00, 0xEF,
+	0x11, LCD_SEQ_DELAY | 0, 120,		//Exit Sleep
+	0x29, 0,							//Display on
+	LCD_SEQ_END
+};
+
+// Khoi dong nong: LCD van giu cau hinh, chi can dam bao dang bat
+static const u8 pbyIli9341Warm[] = {
+	0x11, LCD_SEQ_DELAY | 0, 5,			//Exit Sleep
+	0x29, 0,							//Display on
+	LCD_SEQ_END
+};
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void LCD_SeqSend(u8 byData);
+
+static void LCD_SeqFlush(void);
+
+static void LCD_SeqDmaInit(void);
+
+static void LCD_SeqDmaStart(const u8 *pbyData,u16 wBytes);
+
+static void LCD_SeqDmaWait(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   LCD_SeqWriteCmd
+ * @brief  Gui 1 thanh ghi va cac byte tham so trong 1 lan keo CS xuong,
+ *         thay cho LCD_WR_REG + n lan LCD_WR_DATA (moi lan 1 lan dao CS)
+ * @param  byReg: Thanh ghi lenh
+ * @param  pbyParam, byLen: Mang tham so va do dai (co the bang 0)
+ * @retval None
+ */
+void LCD_SeqWriteCmd(u8 byReg,const u8 *pbyParam,u8 byLen)
+{
+	LCD_CS_CLR;
+	LCD_RS_CLR;
+	LCD_SeqSend(byReg);
+	LCD_SeqFlush();
+	LCD_RS_SET;
+	for(u8 i = 0; i < byLen; i++)
+	{
+		LCD_SeqSend(pbyParam[i]);
+	}
+	LCD_SeqFlush();
+	LCD_CS_SET;
+}
+/**
+ * @func   LCD_SeqSetWindows
+ * @brief  Dat cua so ghi GRAM va gui lenh ghi RAM. Bo qua lenh dat cot/hang
+ *         khi toa do trung voi cua so dang luu
+ * @param  wXs, wYs, wXe, wYe: Toa do cua so
+ * @retval None
+ */
+void LCD_SeqSetWindows(u16 wXs,u16 wYs,u16 wXe,u16 wYe)
+{
+	u8 pbyParam[4];
+
+	if((byWinValid == 0)||(pwWin[0] != wXs)||(pwWin[2] != wXe))
+	{
+		pbyParam[0] = wXs>>8;
+		pbyParam[1] = wXs;
+		pbyParam[2] = wXe>>8;
+		pbyParam[3] = wXe;
+		LCD_SeqWriteCmd(lcddev.setxcmd, pbyParam, 4);
+	}
+	if((byWinValid == 0)||(pwWin[1] != wYs)||(pwWin[3] != wYe))
+	{
+		pbyParam[0] = wYs>>8;
+		pbyParam[1] = wYs;
+		pbyParam[2] = wYe>>8;
+		pbyParam[3] = wYe;
+		LCD_SeqWriteCmd(lcddev.setycmd, pbyParam, 4);
+	}
+	pwWin[0] = wXs;
+	pwWin[1] = wYs;
+	pwWin[2] = wXe;
+	pwWin[3] = wYe;
+	byWinValid = 1;
+
+	LCD_SeqWriteCmd(lcddev.wramcmd, NULL, 0);
+}
+/**
+ * @func   LCD_SeqInvalidate
+ * @brief  Huy cua so dang luu. Goi sau khi ve qua cac ham cua lcd.c/GUI.c
+ *         vi chung tu dat cua so rieng
+ * @param  None
+ * @retval None
+ */
+void LCD_SeqInvalidate(void)
+{
+	byWinValid = 0;
+}
+/**
+ * @func   LCD_SeqWritePixels
+ * @brief  Ghi dwCount diem cung mau vao cua so hien tai trong 1 lan giu CS.
+ *         Chi cho TXE giua cac byte, khong cho RXNE nhu SPI_WriteByte
+ * @param  wColor: Mau RGB565
+ * @param  dwCount: So diem anh
+ * @retval None
+ */
+RAMFUNC void LCD_SeqWritePixels(u16 wColor,uint32_t dwCount)
+{
+	u8 byHigh = wColor>>8;
+	u8 byLow = wColor;
+	u8 *pbyBuf = pbyLineBuf[0];
+	uint32_t dwChunk;
+
+	LCD_CS_CLR;
+	LCD_RS_SET;
+	if(dwCount < LCD_SEQ_DMA_MIN_PIXELS)
+	{
+		while(dwCount--)
+		{
+			LCD_SeqSend(byHigh);
+			LCD_SeqSend(byLow);
+		}
+	}else
+	{
+		//Mau khong doi: dien 1 bo dem roi gui lap lai bang DMA
+		dwChunk = (dwCount < LCD_SEQ_LINE_MAX/2) ? dwCount : LCD_SEQ_LINE_MAX/2;
+		for(uint32_t i = 0; i < dwChunk; i++)
+		{
+			pbyBuf[2*i] = byHigh;
+			pbyBuf[2*i + 1] = byLow;
+		}
+		while(dwCount != 0)
+		{
+			if(dwChunk > dwCount)
+			{
+				dwChunk = dwCount;
+			}
+			LCD_SeqDmaStart(pbyBuf, dwChunk*2);
+			LCD_SeqDmaWait();
+			dwCount -= dwChunk;
+		}
+	}
+	LCD_SeqFlush();
+	LCD_CS_SET;
+}
+/**
+ * @func   LCD_SeqFill
+ * @brief  To mau vung chu nhat: 1 cua so + 1 lan ghi lien tuc
+ * @param  wXs, wYs, wXe, wYe: Toa do vung
+ * @param  wColor: Mau to
+ * @retval None
+ */
+void LCD_SeqFill(u16 wXs,u16 wYs,u16 wXe,u16 wYe,u16 wColor)
+{
+	if((wXe < wXs)||(wYe < wYs))
+	{
+		return;
+	}
+	LCD_SeqSetWindows(wXs, wYs, wXe, wYe);
+	LCD_SeqWritePixels(wColor, (uint32_t)(wXe - wXs + 1)*(wYe - wYs + 1));
+}
+/**
+ * @func   LCD_SeqRunTable
+ * @brief  Gui lan luot cac lenh trong bang, moi lenh 1 lan giu CS
+ * @param  pbyTable: Bang lenh, ket thuc bang LCD_SEQ_END
+ * @retval None
+ */
+void LCD_SeqRunTable(const u8 *pbyTable)
+{
+	u8 byLen;
+
+	while(*pbyTable != LCD_SEQ_END)
+	{
+		byLen = pbyTable[1] & ~LCD_SEQ_DELAY;
+		LCD_SeqWriteCmd(pbyTable[0], &pbyTable[2], byLen);
+		if(pbyTable[1] & LCD_SEQ_DELAY)
+		{
+			delay_ms(pbyTable[2 + byLen]);
+			pbyTable++;
+		}
+		pbyTable += 2 + byLen;
+	}
+	byWinValid = 0;
+}
+/**
+ * @func   LCD_SeqInit
+ * @brief  Khoi tao LCD bang bang lenh. Sau reset khong do mat nguon (reset
+ *         chan, phan mem, watchdog) LCD van giu cau hinh nen bo qua reset
+ *         cung va trinh tu khoi tao day du. Khong xoa man hinh: nguoi goi
+ *         ve ngay 1 khung hinh day du (logo)
+ * @param  None
+ * @retval 1 neu khoi dong nong, 0 neu khoi tao day du
+ */
+uint8_t LCD_SeqInit(void)
+{
+	uint8_t byWarm = 1;
+
+	if((RCC_GetFlagStatus(RCC_FLAG_PORRST) != RESET) ||
+			(RCC_GetFlagStatus(RCC_FLAG_BORRST) != RESET))
+	{
+		byWarm = 0;
+	}
+	RCC_ClearFlag();
+
+	SPI1_Init();
+	LCD_SeqDmaInit();
+	LCD_GPIOInit();
+	if(byWarm)
+	{
+		LCD_SeqRunTable(pbyIli9341Warm);
+	}else
+	{
+		LCD_RESET();
+		LCD_SeqRunTable(pbyIli9341Init);
+	}
+	LCD_direction(USE_HORIZONTAL);
+	LCD_LED = 1;
+	return byWarm;
+}
+/**
+ * @func   LCD_SeqLineBegin
+ * @brief  Bat dau ghi theo dong vao cua so, giu CS cho toi LCD_SeqLineEnd
+ * @param  wXs, wYs, wXe, wYe: Toa do cua so
+ * @retval None
+ */
+void LCD_SeqLineBegin(u16 wXs,u16 wYs,u16 wXe,u16 wYe)
+{
+	LCD_SeqSetWindows(wXs, wYs, wXe, wYe);
+	byLineIdx = 0;
+	LCD_CS_CLR;
+	LCD_RS_SET;
+}
+/**
+ * @func   LCD_SeqLineGet
+ * @brief  Lay bo dem dong dang ranh de CPU ve dong tiep theo. Bo dem con lai
+ *         co the dang duoc DMA gui
+ * @param  None
+ * @retval Bo dem LCD_SEQ_LINE_MAX byte
+ */
+u8 *LCD_SeqLineGet(void)
+{
+	return pbyLineBuf[byLineIdx];
+}
+/**
+ * @func   LCD_SeqLinePut
+ * @brief  Gui bo dem vua ve bang DMA. Chi cho DMA cua dong truoc xong,
+ *         khong cho dong nay, nen CPU ve dong sau song song voi viec truyen
+ * @param  wBytes: So byte cua dong
+ * @retval None
+ */
+void LCD_SeqLinePut(u16 wBytes)
+{
+	LCD_SeqDmaWait();
+	LCD_SeqDmaStart(pbyLineBuf[byLineIdx], wBytes);
+	byLineIdx ^= 1;
+}
+/**
+ * @func   LCD_SeqLineEnd
+ * @brief  Cho dong cuoi truyen xong va nha CS
+ * @param  None
+ * @retval None
+ */
+void LCD_SeqLineEnd(void)
+{
+	LCD_SeqDmaWait();
+	LCD_SeqFlush();
+	LCD_CS_SET;
+}
+/**
+ * @func   LCD_SeqDrawBmp16
+ * @brief  Ve anh RGB565 (byte thap truoc, nhu Gui_Drawbmp16) qua duong ong
+ *         2 bo dem dong: dao byte dong N+1 trong khi DMA gui dong N
+ * @param  wX, wY: Goc tren trai
+ * @param  wWidth, wHeight: Kich thuoc anh, wWidth*2 <= LCD_SEQ_LINE_MAX
+ * @param  pbyImage: Du lieu anh
+ * @retval None
+ */
+void LCD_SeqDrawBmp16(u16 wX,u16 wY,u16 wWidth,u16 wHeight,const u8 *pbyImage)
+{
+	u8 *pbyLine;
+
+	if((wWidth == 0)||(wHeight == 0)||(wWidth*2 > LCD_SEQ_LINE_MAX))
+	{
+		return;
+	}
+	LCD_SeqLineBegin(wX, wY, wX + wWidth - 1, wY + wHeight - 1);
+	for(u16 y = 0; y < wHeight; y++)
+	{
+		pbyLine = LCD_SeqLineGet();
+		kSwapRgb565(pbyLine, pbyImage, wWidth);
+		pbyImage += wWidth*2;
+		LCD_SeqLinePut(wWidth*2);
+	}
+	LCD_SeqLineEnd();
+}
+/**
+ * @func   LCD_SeqSend
+ * @brief  Day 1 byte vao SPI ngay khi bo dem truyen trong
+ * @param  byData: Byte can gui
+ * @retval None
+ */
+RAMFUNC static void LCD_SeqSend(u8 byData)
+{
+	while((LCD_SEQ_SPI->SR & SPI_I2S_FLAG_TXE) == RESET);
+	LCD_SEQ_SPI->DR = byData;
+}
+/**
+ * @func   LCD_SeqFlush
+ * @brief  Cho byte cuoi truyen xong truoc khi doi RS/CS, xoa co RXNE/OVR
+ *         do bo qua viec doc DR sau moi byte
+ * @param  None
+ * @retval None
+ */
+static void LCD_SeqFlush(void)
+{
+	volatile u16 wDummy;
+
+	while((LCD_SEQ_SPI->SR & SPI_I2S_FLAG_TXE) == RESET);
+	while((LCD_SEQ_SPI->SR & SPI_I2S_FLAG_BSY) != RESET);
+	wDummy = LCD_SEQ_SPI->DR;
+	wDummy = LCD_SEQ_SPI->SR;
+	(void)wDummy;
+}
+/**
+ * @func   LCD_SeqDmaInit
+ * @brief  Cau hinh DMA2 Stream3 cho SPI1 TX, bo nho -> ngoai vi, tung byte
+ * @param  None
+ * @retval None
+ */
+static void LCD_SeqDmaInit(void)
+{
+	DMA_InitTypeDef DMA_InitStructure;
+
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+	DMA_DeInit(LCD_SEQ_DMA_STREAM);
+
+	DMA_StructInit(&DMA_InitStructure);
+	DMA_InitStructure.DMA_Channel = LCD_SEQ_DMA_CHANNEL;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&LCD_SEQ_SPI->DR;
+	DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)pbyLineBuf[0];
+	DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStructure.DMA_BufferSize = 1;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+	DMA_Init(LCD_SEQ_DMA_STREAM, &DMA_InitStructure);
+
+	SPI_I2S_DMACmd(LCD_SEQ_SPI, SPI_I2S_DMAReq_Tx, ENABLE);
+	byDmaBusy = 0;
+}
+/**
+ * @func   LCD_SeqDmaStart
+ * @brief  Bat dau gui wBytes byte bang DMA, khong cho ket thuc
+ * @param
+ * @retval None
+ */
+static void LCD_SeqDmaStart(const u8 *pbyData,u16 wBytes)
+{
+	DMA_Cmd(LCD_SEQ_DMA_STREAM, DISABLE);
+	while(DMA_GetCmdStatus(LCD_SEQ_DMA_STREAM) != DISABLE);
+	DMA_ClearFlag(LCD_SEQ_DMA_STREAM, LCD_SEQ_DMA_FLAG_ALL);
+	LCD_SEQ_DMA_STREAM->M0AR = (uint32_t)pbyData;
+	DMA_SetCurrDataCounter(LCD_SEQ_DMA_STREAM, wBytes);
+	DMA_Cmd(LCD_SEQ_DMA_STREAM, ENABLE);
+	byDmaBusy = 1;
+}
+/**
+ * @func   LCD_SeqDmaWait
+ * @brief  Cho lan DMA dang chay (neu co) ket thuc
+ * @param  None
+ * @retval None
+ */
+static void LCD_SeqDmaWait(void)
+{
+	if(byDmaBusy)
+	{
+		while(DMA_GetFlagStatus(LCD_SEQ_DMA_STREAM, LCD_SEQ_DMA_FLAG_TC) == RESET);
+		byDmaBusy = 0;
+	}
+}
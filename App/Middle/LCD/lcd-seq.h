@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: lcd-seq.h
+ *
+ * Description: Gui lenh LCD kem tham so trong 1 lan giu CS, luu cua so hien tai
+ *              de bo qua lenh dat cua so trung lap.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _LCD_SEQ_H_
+#define _LCD_SEQ_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "lcd.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// Dinh dang bang lenh: {thanh ghi, so tham so [| LCD_SEQ_DELAY], tham so..., [ms]}
+#define LCD_SEQ_DELAY						0x80
+#define LCD_SEQ_END							0xFF
+// Kich thuoc 1 bo dem dong (byte), du cho 1 dong dai nhat o moi huong man hinh
+#define LCD_SEQ_LINE_MAX					(LCD_H * 2)
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void LCD_SeqWriteCmd(u8 byReg,const u8 *pbyParam,u8 byLen);
+
+void LCD_SeqSetWindows(u16 wXs,u16 wYs,u16 wXe,u16 wYe);
+
+void LCD_SeqInvalidate(void);
+
+void LCD_SeqWritePixels(u16 wColor,uint32_t dwCount);
+
+void LCD_SeqFill(u16 wXs,u16 wYs,u16 wXe,u16 wYe,u16 wColor);
+
+void LCD_SeqRunTable(const u8 *pbyTable);
+
+void LCD_SeqLineBegin(u16 wXs,u16 wYs,u16 wXe,u16 wYe);
+
+u8 *LCD_SeqLineGet(void);
+
+void LCD_SeqLinePut(u16 wBytes);
+
+void LCD_SeqLineEnd(void);
+
+void LCD_SeqDrawBmp16(u16 wX,u16 wY,u16 wWidth,u16 wHeight,const u8 *pbyImage);
+
+uint8_t LCD_SeqInit(void);
+
+#endif
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: cycle-count.c
+ *
+ * Description: Bat bo dem chu ky DWT->CYCCNT va bat/tat ART (prefetch, I-cache,
+ *              D-cache cua flash) de do ham RAMFUNC khi ART bat va tat.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re.h"
+#include "cycle-count.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define CYCLE_ART_BITS						(FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   cycleCountInit
+ * @brief  Bat khoi trace (TRCENA) va bo dem chu ky DWT, dem tu 0
+ * @param  None
+ * @retval None
+ */
+void cycleCountInit(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+/**
+ * @func   cycleCountSetArt
+ * @brief  Bat/tat ART. Cache chi duoc xoa khi dang tat nen khi bat lai thi
+ *         xoa truoc, tranh dung lenh cu sau khi flash da bi ghi
+ * @param  byOn: 1 bat, 0 tat
+ * @retval None
+ */
+void cycleCountSetArt(uint8_t byOn)
+{
+	FLASH->ACR &= ~CYCLE_ART_BITS;
+	if(byOn)
+	{
+		FLASH->ACR |= FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+		FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+		FLASH->ACR |= CYCLE_ART_BITS;
+	}
+}
+/**
+ * @func   cycleCountArtIsOn
+ * @brief  ART dang bat hay khong (theo I-cache)
+ * @param  None
+ * @retval 1 neu dang bat
+ */
+uint8_t cycleCountArtIsOn(void)
+{
+	return (FLASH->ACR & FLASH_ACR_ICEN) ? 1 : 0;
+}
+/**
+ * @func   cycleProbeReset
+ * @brief  Xoa ket qua do, goi sau khi doi ART de so lieu khong lan nhau
+ * @param  pProbe: Diem do
+ * @retval None
+ */
+void cycleProbeReset(CycleProbe_t *pProbe)
+{
+	pProbe->dwLast = 0;
+	pProbe->dwMax = 0;
+	pProbe->dwCount = 0;
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: cycle-count.h
+ *
+ * Description: Do so chu ky CPU bang DWT->CYCCNT va bat/tat ART de so sanh
+ *              ham chay tu SRAM (RAMFUNC) voi ham chay tu flash.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _CYCLE_COUNT_H_
+#define _CYCLE_COUNT_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#if defined(__arm__)
+#include "stm32f401re.h"
+#endif
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef struct {
+	volatile uint32_t	dwLast;		//So chu ky lan do gan nhat
+	volatile uint32_t	dwMax;		//Lon nhat tu lan xoa gan nhat
+	volatile uint32_t	dwCount;	//So lan do
+}CycleProbe_t;
+
+#if defined(__arm__)
+#define CYCLE_NOW()							(DWT->CYCCNT)
+#else
+// Ban dich tren may tinh (tests/host): khong co DWT, moi lan do bang 0
+#define CYCLE_NOW()							((uint32_t)0)
+#endif
+
+// Macro (khong goi ham) de dung duoc trong ham RAMFUNC ma khong nhay ra flash
+#define CYCLE_PROBE_STOP(probe,dwStart)		do{ \
+		uint32_t dwCycles_ = CYCLE_NOW() - (dwStart); \
+		(probe).dwLast = dwCycles_; \
+		if(dwCycles_ > (probe).dwMax) (probe).dwMax = dwCycles_; \
+		(probe).dwCount++; \
+	}while(0)
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void cycleCountInit(void);
+
+void cycleCountSetArt(uint8_t byOn);
+
+uint8_t cycleCountArtIsOn(void);
+
+void cycleProbeReset(CycleProbe_t *pProbe);
+
+#endif
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: mac-set.c
+ *
+ * Description: Tap MAC 64 bit dia chi mo (do tuyen tinh) trong bang co dinh,
+ *              tra cuu va them O(1) de phat hien MAC trung.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "mac-set.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// MAC 0 khong hop le nen dung lam o trong
+#define MAC_SET_EMPTY						0
+// Bam Fibonacci: nhan voi 2^64/phi, lay MAC_SET_BITS bit cao
+#define MAC_SET_HASH(mac)					((uint32_t)(((mac) * 0x9E3779B97F4A7C15ULL) >> (64 - MAC_SET_BITS)))
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static uint64_t pqwMacTable[MAC_SET_SIZE];
+static uint16_t wMacCount = 0;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint32_t macSetFind(uint64_t qwMAC);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   macSetClear
+ * @brief  Xoa toan bo tap
+ * @param  None
+ * @retval None
+ */
+void macSetClear(void)
+{
+	memset(pqwMacTable, 0, sizeof(pqwMacTable));
+	wMacCount = 0;
+}
+/**
+ * @func   macSetCount
+ * @brief  So MAC dang co trong tap
+ * @param  None
+ * @retval So MAC
+ */
+uint16_t macSetCount(void)
+{
+	return wMacCount;
+}
+/**
+ * @func   macSetContains
+ * @brief  Kiem tra MAC da co trong tap chua
+ * @param  qwMAC: MAC dang so 64 bit
+ * @retval 1 neu da co
+ */
+uint8_t macSetContains(uint64_t qwMAC)
+{
+	if(qwMAC == MAC_SET_EMPTY)
+	{
+		return 0;
+	}
+	return pqwMacTable[macSetFind(qwMAC)] == qwMAC;
+}
+/**
+ * @func   macSetInsert
+ * @brief  Them MAC vao tap neu chua co. Khong them khi da day MAC_SET_MAX_FILL
+ *         de chuoi do khong qua dai
+ * @param  qwMAC: MAC dang so 64 bit
+ * @retval MAC_SET_ADDED, MAC_SET_EXISTS hoac MAC_SET_FULL
+ */
+MacSetResult_e macSetInsert(uint64_t qwMAC)
+{
+	uint32_t dwIdx;
+
+	if(qwMAC == MAC_SET_EMPTY)
+	{
+		return MAC_SET_ADDED;
+	}
+	dwIdx = macSetFind(qwMAC);
+	if(pqwMacTable[dwIdx] == qwMAC)
+	{
+		return MAC_SET_EXISTS;
+	}
+	if(wMacCount >= MAC_SET_MAX_FILL)
+	{
+		return MAC_SET_FULL;
+	}
+	pqwMacTable[dwIdx] = qwMAC;
+	wMacCount++;
+	return MAC_SET_ADDED;
+}
+/**
+ * @func   macFromBytes
+ * @brief  Ghep 8 byte MAC (byte dau la byte cao) thanh so 64 bit
+ * @param  pbyMAC: 8 byte MAC
+ * @retval MAC dang so 64 bit
+ */
+uint64_t macFromBytes(const uint8_t *pbyMAC)
+{
+	uint64_t qwMAC = 0;
+
+	for(uint8_t i = 0; i < 8; i++)
+	{
+		qwMAC = (qwMAC << 8) | pbyMAC[i];
+	}
+	return qwMAC;
+}
+/**
+ * @func   macSetFind
+ * @brief  Do tuyen tinh tu vi tri bam den khi gap MAC can tim hoac o trong
+ * @param  qwMAC: MAC khac 0
+ * @retval Vi tri cua MAC, hoac o trong dau tien neu chua co
+ */
+static uint32_t macSetFind(uint64_t qwMAC)
+{
+	uint32_t dwIdx = MAC_SET_HASH(qwMAC);
+
+	while(pqwMacTable[dwIdx] != MAC_SET_EMPTY && pqwMacTable[dwIdx] != qwMAC)
+	{
+		dwIdx = (dwIdx + 1) & (MAC_SET_SIZE - 1);
+	}
+	return dwIdx;
+}
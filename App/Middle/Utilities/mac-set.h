@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: mac-set.h
+ *
+ * Description: Tap MAC 64 bit dia chi mo (do tuyen tinh) trong bang co dinh,
+ *              tra cuu va them O(1) de phat hien MAC trung.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _MAC_SET_H_
+#define _MAC_SET_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define MAC_SET_BITS						12
+#define MAC_SET_SIZE						(1 << MAC_SET_BITS)		//32K RAM
+#define MAC_SET_MAX_FILL					(MAC_SET_SIZE * 3 / 4)	//Giu do day <= 75%
+
+typedef enum {
+	MAC_SET_ADDED		= 0x00,
+	MAC_SET_EXISTS		= 0x01,
+	MAC_SET_FULL		= 0x02
+}MacSetResult_e;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void macSetClear(void);
+
+uint16_t macSetCount(void);
+
+uint8_t macSetContains(uint64_t qwMAC);
+
+MacSetResult_e macSetInsert(uint64_t qwMAC);
+
+uint64_t macFromBytes(const uint8_t *pbyMAC);
+
+#endif
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: ram-func.h
+ *
+ * Description: Dat ham vao SRAM: section .RamFunc nam trong .data nen duoc
+ *              startup chep cung luc voi du lieu khoi tao.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _RAM_FUNC_H_
+#define _RAM_FUNC_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// Ham chay tu SRAM, khong chiu wait state cua flash khi ART bo lo (nhanh tu
+// ngat, vong lap dai hon I-cache). long_call vi SRAM cach flash qua tam BL;
+// chieu nguoc lai (SRAM goi flash) linker tu chen veneer. So chu ky khi ART
+// bat/tat do bang cycle-count.h (man hinh Diagnostics)
+#if defined(__arm__)
+#define RAMFUNC								__attribute__((section(".RamFunc"), long_call))
+#else
+// Ban dich tren may tinh (tests/host): ham o vi tri mac dinh
+#define RAMFUNC
+#endif
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+
+#endif
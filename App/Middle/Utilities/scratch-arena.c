@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: scratch-arena.c
+ *
+ * Description: Vung nho tam co dinh (section .scratch do linker dat) cap phat
+ *              kieu bump theo pham vi mark/release, xoa het moi DUT. Thay cho
+ *              VLA tren stack cua bo ma QR va bo dem ve man hinh.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stddef.h>
+#include "scratch-arena.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+// NOLOAD: khong ton thoi gian xoa 0 luc khoi dong, noi dung khong xac dinh
+static uint8_t pbyScratchArena[SCRATCH_ARENA_SIZE] \
+	__attribute__((section(".scratch"), aligned(8)));
+static ScratchArenaStats_t scratchStats = {0};
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   scratchArenaReset
+ * @brief  Tra lai toan bo vung nho tam, goi khi chuyen sang DUT moi
+ * @param  None
+ * @retval None
+ */
+void scratchArenaReset(void)
+{
+	scratchStats.wUsed = 0;
+}
+/**
+ * @func   scratchAlloc
+ * @brief  Cap phat wSize byte (can le SCRATCH_ARENA_ALIGN), noi dung chua
+ *         khoi tao. Chi song den scratchRelease/scratchArenaReset
+ * @param  wSize: So byte
+ * @retval Con tro, NULL neu het cho
+ */
+void *scratchAlloc(uint16_t wSize)
+{
+	uint32_t dwEnd = scratchStats.wUsed + \
+			(((uint32_t)wSize + SCRATCH_ARENA_ALIGN - 1) & ~(uint32_t)(SCRATCH_ARENA_ALIGN - 1));
+	void *pMem;
+
+	if(dwEnd > SCRATCH_ARENA_SIZE)
+	{
+		scratchStats.wFailCnt++;
+		return NULL;
+	}
+	pMem = &pbyScratchArena[scratchStats.wUsed];
+	scratchStats.wUsed = (uint16_t)dwEnd;
+	if(scratchStats.wUsed > scratchStats.wHighWater)
+	{
+		scratchStats.wHighWater = scratchStats.wUsed;
+	}
+	return pMem;
+}
+/**
+ * @func   scratchMark
+ * @brief  Danh dau dau 1 pham vi cap phat
+ * @param  None
+ * @retval Moc de tra cho scratchRelease
+ */
+ScratchMark_t scratchMark(void)
+{
+	return scratchStats.wUsed;
+}
+/**
+ * @func   scratchRelease
+ * @brief  Tra lai moi thu cap phat sau moc (ket thuc pham vi)
+ * @param  mark: Moc lay tu scratchMark
+ * @retval None
+ */
+void scratchRelease(ScratchMark_t mark)
+{
+	if(mark < scratchStats.wUsed)
+	{
+		scratchStats.wUsed = mark;
+	}
+}
+/**
+ * @func   scratchArenaStats
+ * @brief  Thong ke su dung cho man hinh chan doan
+ * @param  None
+ * @retval Con tro toi thong ke
+ */
+const ScratchArenaStats_t *scratchArenaStats(void)
+{
+	return &scratchStats;
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: scratch-arena.h
+ *
+ * Description: Vung nho tam co dinh (section .scratch do linker dat) cap phat
+ *              kieu bump theo pham vi mark/release, xoa het moi DUT. Thay cho
+ *              VLA tren stack cua bo ma QR va bo dem ve man hinh.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _SCRATCH_ARENA_H_
+#define _SCRATCH_ARENA_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// Du cho QR version 40 (177*177 bit = 3917 byte) cung bo dem ECC cua qrcode
+#define SCRATCH_ARENA_SIZE					8192
+#define SCRATCH_ARENA_ALIGN					4
+
+typedef uint16_t ScratchMark_t;
+
+typedef struct {
+	uint16_t	wUsed;				//Dang cap phat
+	uint16_t	wHighWater;			//Lon nhat tu khi khoi dong
+	uint16_t	wFailCnt;			//So lan cap phat that bai do het cho
+}ScratchArenaStats_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void scratchArenaReset(void);
+
+void *scratchAlloc(uint16_t wSize);
+
+ScratchMark_t scratchMark(void);
+
+void scratchRelease(ScratchMark_t mark);
+
+const ScratchArenaStats_t *scratchArenaStats(void);
+
+#endif
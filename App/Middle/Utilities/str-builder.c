@@ -0,0 +1,228 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: str-builder.c
+ *
+ * Description: Ghep chuoi co gioi han kich thuoc va ma hoa hex bang bang tra,
+ *              moi lan ghep chi ghi tiep vao cuoi, khong quet lai chuoi.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "str-builder.h"
+#include "swar-kernels.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   sbInit
+ * @brief  Gan bo dem cho bo ghep chuoi va dat chuoi rong
+ * @param  pSb: Bo ghep chuoi
+ * @param  pBuf, wSize: Bo dem va kich thuoc (wSize >= 1)
+ * @retval None
+ */
+void sbInit(StrBuilder_t *pSb,char *pBuf,uint16_t wSize)
+{
+	pSb->pBuf = pBuf;
+	pSb->wSize = wSize;
+	pSb->wLen = 0;
+	pSb->byOverflow = 0;
+	pBuf[0] = 0;
+}
+/**
+ * @func   sbAppendChar
+ * @brief  Ghep 1 ky tu, bo qua neu bo dem day
+ * @param
+ * @retval None
+ */
+void sbAppendChar(StrBuilder_t *pSb,char c)
+{
+	if(pSb->wLen + 1 >= pSb->wSize)
+	{
+		pSb->byOverflow = 1;
+		return;
+	}
+	pSb->pBuf[pSb->wLen++] = c;
+	pSb->pBuf[pSb->wLen] = 0;
+}
+/**
+ * @func   sbAppendStr
+ * @brief  Ghep chuoi vao cuoi, cat bot neu vuot kich thuoc bo dem
+ * @param
+ * @retval None
+ */
+void sbAppendStr(StrBuilder_t *pSb,const char *pStr)
+{
+	char *pDst = &pSb->pBuf[pSb->wLen];
+	uint16_t wFree = pSb->wSize - pSb->wLen - 1;
+
+	while((*pStr != 0)&&(wFree != 0))
+	{
+		*pDst++ = *pStr++;
+		wFree--;
+	}
+	if(*pStr != 0)
+	{
+		pSb->byOverflow = 1;
+	}
+	*pDst = 0;
+	pSb->wLen = pDst - pSb->pBuf;
+}
+/**
+ * @func   sbAppendHex
+ * @brief  Ghep byLen byte duoi dang hex in hoa: {0x0A,0x1B} -> "0A1B"
+ * @param
+ * @retval None
+ */
+void sbAppendHex(StrBuilder_t *pSb,const uint8_t *pbyData,uint8_t byLen)
+{
+	if(pSb->wLen + byLen*2 >= pSb->wSize)
+	{
+		pSb->byOverflow = 1;
+		return;
+	}
+	kHexEncode(&pSb->pBuf[pSb->wLen], pbyData, byLen);
+	pSb->wLen += byLen*2;
+}
+/**
+ * @func   sbAppendHexSep
+ * @brief  Ghep hex co ky tu phan cach giua cac byte: "0A:1B". cSep = 0 de
+ *         khong phan cach. Ma hoa bang kHexEncode vao cuoi vung can ghi roi
+ *         dan ra phia truoc, chen ky tu phan cach (khong de len phan chua doc)
+ * @param
+ * @retval None
+ */
+void sbAppendHexSep(StrBuilder_t *pSb,const uint8_t *pbyData,uint8_t byLen,char cSep)
+{
+	uint16_t wNeed;
+	char *pDst;
+	char *pSrc;
+	char cHigh;
+	char cLow;
+
+	if((cSep == 0)||(byLen == 0))
+	{
+		sbAppendHex(pSb, pbyData, byLen);
+		return;
+	}
+	wNeed = byLen*3 - 1;
+	if(pSb->wLen + wNeed >= pSb->wSize)
+	{
+		pSb->byOverflow = 1;
+		return;
+	}
+	pDst = &pSb->pBuf[pSb->wLen];
+	pSrc = pDst + byLen - 1;
+	kHexEncode(pSrc, pbyData, byLen);
+	for(uint8_t i = 0; i < byLen; i++)
+	{
+		cHigh = *pSrc++;
+		cLow = *pSrc++;
+		*pDst++ = cHigh;
+		*pDst++ = cLow;
+		if(i + 1 < byLen)
+		{
+			*pDst++ = cSep;
+		}
+	}
+	pSb->wLen += wNeed;
+}
+/**
+ * @func   sbAppendHexValue
+ * @brief  Ghep byBytes byte thap cua so nguyen dang hex, byte cao truoc
+ *         (MAC 64 bit, version dong goi...). cSep = 0 de khong phan cach
+ * @param
+ * @retval None
+ */
+void sbAppendHexValue(StrBuilder_t *pSb,uint64_t qwValue,uint8_t byBytes,char cSep)
+{
+	uint8_t pbyData[8];
+
+	if(byBytes > sizeof(pbyData))
+	{
+		byBytes = sizeof(pbyData);
+	}
+	for(uint8_t i = byBytes; i > 0; i--)
+	{
+		pbyData[i - 1] = (uint8_t)qwValue;
+		qwValue >>= 8;
+	}
+	sbAppendHexSep(pSb, pbyData, byBytes, cSep);
+}
+/**
+ * @func   sbAppendDec
+ * @brief  Ghep so nguyen khong dau dang thap phan. Khong du cho moi chu so
+ *         thi khong ghi gi (nhu sbAppendHex), tranh de lai so bi cat
+ * @param
+ * @retval None
+ */
+void sbAppendDec(StrBuilder_t *pSb,uint32_t dwValue)
+{
+	char pcDigit[10];
+	uint8_t byCnt = 0;
+	char *pDst;
+
+	do{
+		pcDigit[byCnt++] = '0' + (dwValue % 10);
+		dwValue /= 10;
+	}while(dwValue != 0);
+	if(pSb->wLen + byCnt >= pSb->wSize)
+	{
+		pSb->byOverflow = 1;
+		return;
+	}
+	pDst = &pSb->pBuf[pSb->wLen];
+	pSb->wLen += byCnt;
+	while(byCnt > 0)
+	{
+		*pDst++ = pcDigit[--byCnt];
+	}
+	*pDst = 0;
+}
+/**
+ * @func   strHexEncode
+ * @brief  Ma hoa hex vao pOutPut (toi thieu byLen*2+1 byte), co ky tu ket thuc
+ * @param
+ * @retval So ky tu da ghi
+ */
+uint8_t strHexEncode(char *pOutPut,const uint8_t *pbyInPut,uint8_t byLen)
+{
+	kHexEncode(pOutPut, pbyInPut, byLen);
+	return byLen*2;
+}
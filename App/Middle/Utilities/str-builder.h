@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: str-builder.h
+ *
+ * Description: Ghep chuoi co gioi han kich thuoc va ma hoa hex bang bang tra,
+ *              moi lan ghep chi ghi tiep vao cuoi, khong quet lai chuoi.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _STR_BUILDER_H_
+#define _STR_BUILDER_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef struct {
+	char		*pBuf;
+	uint16_t	wSize;			//Kich thuoc bo dem, tinh ca ky tu ket thuc
+	uint16_t	wLen;			//Do dai chuoi hien tai
+	uint8_t		byOverflow;		//1 neu da bi cat bot
+}StrBuilder_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void sbInit(StrBuilder_t *pSb,char *pBuf,uint16_t wSize);
+
+void sbAppendChar(StrBuilder_t *pSb,char c);
+
+void sbAppendStr(StrBuilder_t *pSb,const char *pStr);
+
+void sbAppendHex(StrBuilder_t *pSb,const uint8_t *pbyData,uint8_t byLen);
+
+void sbAppendHexSep(StrBuilder_t *pSb,const uint8_t *pbyData,uint8_t byLen,char cSep);
+
+void sbAppendHexValue(StrBuilder_t *pSb,uint64_t qwValue,uint8_t byBytes,char cSep);
+
+void sbAppendDec(StrBuilder_t *pSb,uint32_t dwValue);
+
+uint8_t strHexEncode(char *pOutPut,const uint8_t *pbyInPut,uint8_t byLen);
+
+#endif
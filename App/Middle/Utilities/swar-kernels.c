@@ -0,0 +1,195 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: swar-kernels.c
+ *
+ * Description: Cac vong lap nong xu ly 32 bit moi lan (XOR checksum, dao byte
+ *              RGB565, ma hoa hex), dung lenh DSP Cortex-M4 neu co.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "swar-kernels.h"
+#include "ram-func.h"
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "stm32f401re.h"		//CMSIS: __REV16, __UADD8, __SEL
+#endif
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define SWAR_USE_DSP						1
+#else
+#define SWAR_USE_DSP						0
+#endif
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint32_t kLoad32(const uint8_t *pbySrc);
+
+static void kStore32(uint8_t *pbyDst,uint32_t dwValue);
+
+static uint32_t kNibbleToAscii(uint32_t dwNibble);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   kXorChecksum
+ * @brief  XOR tat ca cac byte, moi lan 4 byte, gop 32 bit ve 8 bit o cuoi
+ * @param  pbyData, wLen: Du lieu va do dai
+ * @retval Gia tri XOR
+ */
+RAMFUNC uint8_t kXorChecksum(const uint8_t *pbyData,uint16_t wLen)
+{
+	uint32_t dwAcc = 0;
+
+	while(wLen >= 4)
+	{
+		dwAcc ^= kLoad32(pbyData);
+		pbyData += 4;
+		wLen -= 4;
+	}
+	dwAcc ^= dwAcc >> 16;
+	dwAcc ^= dwAcc >> 8;
+	while(wLen--)
+	{
+		dwAcc ^= *pbyData++;
+	}
+	return (uint8_t)dwAcc;
+}
+/**
+ * @func   kSwapRgb565
+ * @brief  Dao 2 byte cua moi diem RGB565 (byte thap truoc -> byte cao truoc),
+ *         2 diem moi lan bang REV16
+ * @param  pbyDst: Bo dem dich, wPixels*2 byte (co the trung pbySrc)
+ * @param  pbySrc: Du lieu nguon
+ * @param  wPixels: So diem anh
+ * @retval None
+ */
+RAMFUNC void kSwapRgb565(uint8_t *pbyDst,const uint8_t *pbySrc,uint16_t wPixels)
+{
+	uint32_t dwWord;
+	uint8_t byTemp;
+
+	while(wPixels >= 2)
+	{
+		dwWord = kLoad32(pbySrc);
+#if SWAR_USE_DSP
+		dwWord = __REV16(dwWord);
+#else
+		dwWord = ((dwWord & 0x00FF00FF) << 8) | ((dwWord >> 8) & 0x00FF00FF);
+#endif
+		kStore32(pbyDst, dwWord);
+		pbySrc += 4;
+		pbyDst += 4;
+		wPixels -= 2;
+	}
+	if(wPixels != 0)
+	{
+		byTemp = pbySrc[0];
+		pbyDst[0] = pbySrc[1];
+		pbyDst[1] = byTemp;
+	}
+}
+/**
+ * @func   kHexEncode
+ * @brief  Ma hoa hex in hoa khong re nhanh, 2 byte vao -> 4 ky tu moi lan
+ * @param  pOutPut: Chuoi ket qua, toi thieu byLen*2+1 byte
+ * @param  pbyInPut, byLen: Mang byte va do dai
+ * @retval None
+ */
+void kHexEncode(char *pOutPut,const uint8_t *pbyInPut,uint8_t byLen)
+{
+	uint32_t dwIn;
+	uint32_t dwNibble;
+
+	while(byLen >= 2)
+	{
+		//Byte 0..3 cua dwNibble: hi(b0), lo(b0), hi(b1), lo(b1)
+		dwIn = (uint32_t)pbyInPut[0] | ((uint32_t)pbyInPut[1] << 16);
+		dwNibble = ((dwIn >> 4) & 0x000F000F) | ((dwIn & 0x000F000F) << 8);
+		kStore32((uint8_t *)pOutPut, kNibbleToAscii(dwNibble));
+		pbyInPut += 2;
+		pOutPut += 4;
+		byLen -= 2;
+	}
+	if(byLen != 0)
+	{
+		dwNibble = (pbyInPut[0] >> 4) | ((uint32_t)(pbyInPut[0] & 0x0F) << 8);
+		dwNibble = kNibbleToAscii(dwNibble);
+		pOutPut[0] = (char)dwNibble;
+		pOutPut[1] = (char)(dwNibble >> 8);
+		pOutPut += 2;
+	}
+	*pOutPut = 0;
+}
+/**
+ * @func   kLoad32
+ * @brief  Doc 4 byte little-endian, khong can can chinh dia chi
+ * @param
+ * @retval None
+ */
+RAMFUNC static uint32_t kLoad32(const uint8_t *pbySrc)
+{
+	uint32_t dwValue;
+
+	memcpy(&dwValue, pbySrc, sizeof(dwValue));
+	return dwValue;
+}
+/**
+ * @func   kStore32
+ * @brief  Ghi 4 byte, khong can can chinh dia chi
+ * @param
+ * @retval None
+ */
+RAMFUNC static void kStore32(uint8_t *pbyDst,uint32_t dwValue)
+{
+	memcpy(pbyDst, &dwValue, sizeof(dwValue));
+}
+/**
+ * @func   kNibbleToAscii
+ * @brief  Doi 4 nibble (moi byte 0..15) sang 4 ky tu hex in hoa cung luc
+ * @param  dwNibble: 4 nibble
+ * @retval 4 ky tu ASCII
+ */
+static uint32_t kNibbleToAscii(uint32_t dwNibble)
+{
+#if SWAR_USE_DSP
+	//GE[i] = 1 khi nibble + 0xF6 tran byte, tuc la nibble >= 10
+	(void)__UADD8(dwNibble, 0xF6F6F6F6);
+	return __SEL(dwNibble + 0x37373737, dwNibble + 0x30303030);
+#else
+	//Byte = 1 khi nibble >= 10: nibble + 6 co bit 4
+	uint32_t dwAlpha = ((dwNibble + 0x06060606) >> 4) & 0x01010101;
+	return dwNibble + 0x30303030 + dwAlpha*7;
+#endif
+}
@@ -0,0 +1,317 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: button-scan.c
+ *
+ * Description: Quet nut nhan theo ngat TIM3 1 kHz: chong doi kieu tich phan,
+ *              nhan dien nhan 1/2/3 lan va giu, day su kien vao hang doi.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_tim.h"
+#include "misc.h"
+#include "ram-func.h"
+#include "cycle-count.h"
+#include "button-scan.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define BUTTON_SCAN_TIM						TIM3
+#define BUTTON_SCAN_RCC						RCC_APB1Periph_TIM3
+#define BUTTON_SCAN_IRQn					TIM3_IRQn
+#define BUTTON_SCAN_TICK_HZ					1000000
+#define BUTTON_SCAN_RATE_HZ					1000
+#define BUTTON_SCAN_QUEUE_MASK				(BUTTON_SCAN_QUEUE_SIZE - 1)
+
+typedef struct {
+	uint8_t		byIntegrator;		//0 .. BUTTON_SCAN_DEBOUNCE_MS
+	uint8_t		byPressed;			//Trang thai sau chong doi
+	uint8_t		byPressCnt;			//So lan nhan trong chuoi hien tai
+	uint8_t		byHoldSent;			//Da bao giu, bo qua lan nha nay
+	uint16_t	wStateMs;			//Thoi gian tu lan doi trang thai cuoi
+}ButtonScanState_t;
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+static ButtonScanState_t pButtonState[BUTTON_SCAN_CNT];
+
+// Hang doi 1 ghi (ngat) 1 doc (vong lap chinh), khong can khoa
+static volatile uint8_t pbyEventQueue[BUTTON_SCAN_QUEUE_SIZE];
+static volatile uint8_t byQueueHead = 0;
+static volatile uint8_t byQueueTail = 0;
+// Vong lap chinh yeu cau, ngat xoa chuoi nhan dang do o lan quet ke tiep
+static volatile uint8_t byFlushReq = 0;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+CycleProbe_t g_cycleButtonScanIsr;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t buttonScanRead(uint8_t byButton);
+
+static void buttonScanPush(uint8_t byButton,ButtonScanEvt_e event);
+
+static void buttonScanTick(uint8_t byButton);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   buttonScanInit
+ * @brief  Cho TIM3 ngat 1 kHz de quet nut. GPIO da duoc buttonInit cau hinh
+ * @param  None
+ * @retval None
+ */
+void buttonScanInit(void)
+{
+	RCC_ClocksTypeDef RCC_Clocks;
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStruct;
+	NVIC_InitTypeDef NVIC_InitStruct;
+	uint32_t dwTimClk;
+
+	for(uint8_t i = 0; i < BUTTON_SCAN_CNT; i++)
+	{
+		pButtonState[i].byIntegrator = 0;
+		pButtonState[i].byPressed = 0;
+		pButtonState[i].byPressCnt = 0;
+		pButtonState[i].byHoldSent = 0;
+		pButtonState[i].wStateMs = 0;
+	}
+	byQueueHead = 0;
+	byQueueTail = 0;
+	byFlushReq = 0;
+
+	RCC_GetClocksFreq(&RCC_Clocks);
+	dwTimClk = RCC_Clocks.PCLK1_Frequency;
+	if((RCC->CFGR & RCC_CFGR_PPRE1) != 0)
+	{
+		dwTimClk *= 2;
+	}
+
+	RCC_APB1PeriphClockCmd(BUTTON_SCAN_RCC, ENABLE);
+	TIM_TimeBaseStructInit(&TIM_TimeBaseStruct);
+	TIM_TimeBaseStruct.TIM_Prescaler = dwTimClk / BUTTON_SCAN_TICK_HZ - 1;
+	TIM_TimeBaseStruct.TIM_Period = BUTTON_SCAN_TICK_HZ / BUTTON_SCAN_RATE_HZ - 1;
+	TIM_TimeBaseStruct.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseStruct.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseInit(BUTTON_SCAN_TIM, &TIM_TimeBaseStruct);
+	TIM_ClearFlag(BUTTON_SCAN_TIM, TIM_FLAG_Update);
+
+	TIM_ITConfig(BUTTON_SCAN_TIM, TIM_IT_Update, ENABLE);
+	NVIC_InitStruct.NVIC_IRQChannel = BUTTON_SCAN_IRQn;
+	NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 2;
+	NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+	NVIC_Init(&NVIC_InitStruct);
+
+	TIM_Cmd(BUTTON_SCAN_TIM, ENABLE);
+}
+/**
+ * @func   buttonScanGetEvent
+ * @brief  Lay 1 su kien nut tu hang doi
+ * @param  pEvent: Su kien lay ra
+ * @retval 1 neu co su kien
+ */
+uint8_t buttonScanGetEvent(ButtonScanEvent_t *pEvent)
+{
+	uint8_t byTail = byQueueTail;
+	uint8_t byData;
+
+	if(byTail == byQueueHead)
+	{
+		return 0;
+	}
+	byData = pbyEventQueue[byTail & BUTTON_SCAN_QUEUE_MASK];
+	byQueueTail = byTail + 1;
+	pEvent->byButton = byData >> 4;
+	pEvent->byEvent = byData & 0x0F;
+	return 1;
+}
+/**
+ * @func   buttonScanFlush
+ * @brief  Bo cac su kien dang cho va chuoi nhan dang do, goi khi doi man hinh
+ *         de phim nhan luc ve/delay khong bi tinh cho man hinh moi. Nut dang
+ *         giu phai nha ra moi tinh lan nhan tiep theo
+ * @param  None
+ * @retval None
+ */
+void buttonScanFlush(void)
+{
+	// Dat co truoc roi moi bo hang doi: su kien ngat day vao truoc khi thay
+	// co deu bi bo, sau do ngat khong day them tu chuoi cu
+	byFlushReq = 1;
+	byQueueTail = byQueueHead;
+}
+/**
+ * @func   buttonScanProcess
+ * @brief  Doi su kien nut sang phim, cung cach gan nhu processEventButton:
+ *         BTN1 giu/1/2/3 lan = RETURN/SELECT/UP/DOWN, BTN2..BTN5 nhan 1 lan
+ *         = UP/DOWN/LEFT/RIGHT. Moi lan goi lay toi da 1 phim
+ * @param  None
+ * @retval Phim, NOKEY neu khong co
+ */
+ValueKey_e buttonScanProcess(void)
+{
+	static const ValueKey_e pKeyOfBtn1[] = {NOKEY, SELECT, UP, DOWN, RETURN};
+	static const ValueKey_e pKeyOfPress1[] = {NOKEY, UP, DOWN, LEFT, RIGHT};
+	ButtonScanEvent_t event;
+
+	while(buttonScanGetEvent(&event))
+	{
+		if(event.byButton == 0)
+		{
+			return pKeyOfBtn1[event.byEvent];
+		}
+		if(event.byEvent == BUTTON_SCAN_EVT_PRESS_1)
+		{
+			return pKeyOfPress1[event.byButton];
+		}
+	}
+	return NOKEY;
+}
+/**
+ * @func   TIM3_IRQHandler
+ * @brief  Moi 1 ms: quet tat ca cac nut
+ * @param  None
+ * @retval None
+ */
+RAMFUNC void TIM3_IRQHandler(void)
+{
+	uint32_t dwStart = CYCLE_NOW();
+
+	if((BUTTON_SCAN_TIM->SR & TIM_SR_UIF) != 0)
+	{
+		BUTTON_SCAN_TIM->SR = (uint16_t)~TIM_SR_UIF;
+		if(byFlushReq)
+		{
+			byFlushReq = 0;
+			for(uint8_t i = 0; i < BUTTON_SCAN_CNT; i++)
+			{
+				pButtonState[i].byPressCnt = 0;
+				pButtonState[i].byHoldSent = pButtonState[i].byPressed;
+			}
+		}
+		for(uint8_t i = 0; i < BUTTON_SCAN_CNT; i++)
+		{
+			buttonScanTick(i);
+		}
+	}
+	CYCLE_PROBE_STOP(g_cycleButtonScanIsr, dwStart);
+}
+/**
+ * @func   buttonScanRead
+ * @brief  Doc muc chan nut, nut noi xuong GND khi nhan
+ * @param  byButton: Chi so nut
+ * @retval 1 neu dang nhan
+ */
+RAMFUNC static uint8_t buttonScanRead(uint8_t byButton)
+{
+	switch(byButton)
+	{
+	case 0:
+		return BTN1_GET == 0;
+	case 1:
+		return BTN2_GET == 0;
+	case 2:
+		return BTN3_GET == 0;
+	case 3:
+		return BTN4_GET == 0;
+	default:
+		return BTN5_GET == 0;
+	}
+}
+/**
+ * @func   buttonScanPush
+ * @brief  Day su kien vao hang doi, hang doi day thi bo
+ * @param  byButton: Chi so nut
+ * @param  event: Su kien
+ * @retval None
+ */
+RAMFUNC static void buttonScanPush(uint8_t byButton,ButtonScanEvt_e event)
+{
+	uint8_t byHead = byQueueHead;
+
+	if((uint8_t)(byHead - byQueueTail) >= BUTTON_SCAN_QUEUE_SIZE)
+	{
+		return;
+	}
+	pbyEventQueue[byHead & BUTTON_SCAN_QUEUE_MASK] = (byButton << 4) | event;
+	byQueueHead = byHead + 1;
+}
+/**
+ * @func   buttonScanTick
+ * @brief  Chong doi tich phan va nhan dien su kien cho 1 nut, goi moi 1 ms.
+ *         Bo tich phan phai dem du BUTTON_SCAN_DEBOUNCE_MS mau cung muc moi
+ *         doi trang thai; chuoi nhan ket thuc khi nha qua BUTTON_SCAN_GAP_MS
+ * @param  byButton: Chi so nut
+ * @retval None
+ */
+RAMFUNC static void buttonScanTick(uint8_t byButton)
+{
+	ButtonScanState_t *pBtn = &pButtonState[byButton];
+
+	if(buttonScanRead(byButton))
+	{
+		if(pBtn->byIntegrator < BUTTON_SCAN_DEBOUNCE_MS)
+		{
+			pBtn->byIntegrator++;
+		}
+	}else if(pBtn->byIntegrator > 0)
+	{
+		pBtn->byIntegrator--;
+	}
+
+	if(!pBtn->byPressed && pBtn->byIntegrator == BUTTON_SCAN_DEBOUNCE_MS)
+	{
+		pBtn->byPressed = 1;
+		pBtn->wStateMs = 0;
+		pBtn->byPressCnt++;
+	}else if(pBtn->byPressed && pBtn->byIntegrator == 0)
+	{
+		pBtn->byPressed = 0;
+		pBtn->wStateMs = 0;
+		if(pBtn->byHoldSent)
+		{
+			pBtn->byHoldSent = 0;
+			pBtn->byPressCnt = 0;
+		}
+	}else if(pBtn->wStateMs < 0xFFFF)
+	{
+		pBtn->wStateMs++;
+	}
+
+	if(pBtn->byPressed && !pBtn->byHoldSent && pBtn->wStateMs >= BUTTON_SCAN_HOLD_MS)
+	{
+		buttonScanPush(byButton, BUTTON_SCAN_EVT_HOLD);
+		pBtn->byHoldSent = 1;
+		pBtn->byPressCnt = 0;
+	}
+	if(!pBtn->byPressed && pBtn->byPressCnt != 0 && pBtn->wStateMs >= BUTTON_SCAN_GAP_MS)
+	{
+		buttonScanPush(byButton, (pBtn->byPressCnt >= 3) ? BUTTON_SCAN_EVT_PRESS_3 : \
+						(ButtonScanEvt_e)pBtn->byPressCnt);
+		pBtn->byPressCnt = 0;
+	}
+}
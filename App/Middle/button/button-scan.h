@@ -0,0 +1,73 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: button-scan.h
+ *
+ * Description: Quet nut nhan theo ngat TIM3 1 kHz: chong doi kieu tich phan,
+ *              nhan dien nhan 1/2/3 lan va giu, day su kien vao hang doi.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _BUTTON_SCAN_H_
+#define _BUTTON_SCAN_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "button-v1-1.h"
+#include "cycle-count.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define BUTTON_SCAN_CNT						5
+#define BUTTON_SCAN_DEBOUNCE_MS				8		//So mau lien tiep de doi trang thai
+#define BUTTON_SCAN_HOLD_MS					500		//Giu lau hon -> su kien giu
+#define BUTTON_SCAN_GAP_MS					300		//Nha lau hon -> ket thuc chuoi nhan
+#define BUTTON_SCAN_QUEUE_SIZE				16		//Luy thua cua 2
+
+typedef enum {
+	BUTTON_SCAN_EVT_PRESS_1		= 0x01,
+	BUTTON_SCAN_EVT_PRESS_2		= 0x02,
+	BUTTON_SCAN_EVT_PRESS_3		= 0x03,
+	BUTTON_SCAN_EVT_HOLD		= 0x04
+}ButtonScanEvt_e;
+
+typedef struct {
+	uint8_t		byButton;			//0 .. BUTTON_SCAN_CNT-1
+	uint8_t		byEvent;			//ButtonScanEvt_e
+}ButtonScanEvent_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+extern CycleProbe_t g_cycleButtonScanIsr;		//So chu ky TIM3_IRQHandler
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void buttonScanInit(void);
+
+uint8_t buttonScanGetEvent(ButtonScanEvent_t *pEvent);
+
+void buttonScanFlush(void);
+
+ValueKey_e buttonScanProcess(void);
+
+#endif
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: config-store.c
+ *
+ * Description: Luu cau hinh tram vao flash theo kieu ghi noi tiep tren 2 sector,
+ *              doi sector khi day, mat dien giua chung van con ban ghi cu.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "config-store.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define CONFIG_MAGIC						0x43464732	//"CFG2"
+#define CONFIG_NONE							0xFF
+#define CONFIG_ERASED						0xFFFFFFFF
+
+// Moi ban ghi gom cac word: seq, cau hinh, crc, magic. Magic duoc ghi cuoi
+// cung nen ban ghi dang ghi do thi mat dien se khong duoc cong nhan.
+typedef struct {
+	uint32_t			dwSeq;
+	StationConfig_t		config;
+	uint32_t			dwCrc;
+	uint32_t			dwMagic;
+}ConfigRecord_t;
+
+#define CONFIG_RECORD_WORDS					(sizeof(ConfigRecord_t)/4)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint32_t configCrc32(const uint8_t *pbyData,uint16_t wLen);
+
+static const ConfigRecord_t *configSlot(const ConfigStore_t *pStore,uint8_t bySector,uint16_t wSlot);
+
+static uint8_t configSlotIsBlank(const ConfigRecord_t *pRecord);
+
+static uint8_t configSlotIsValid(const ConfigRecord_t *pRecord);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   configStoreInit
+ * @brief  Quet 2 sector, lay ban ghi hop le co seq lon nhat
+ * @param  pStore: Kho luu
+ * @param  pDev: Thao tac flash va vi tri 2 sector
+ * @param  pConfig: Noi chep cau hinh doc duoc (giu nguyen neu khong co)
+ * @retval 1 neu doc duoc cau hinh, 0 neu flash chua co ban ghi nao
+ */
+uint8_t configStoreInit(ConfigStore_t *pStore,const FlashDev_t *pDev,StationConfig_t *pConfig)
+{
+	uint16_t wSlots = pDev->dwSize / sizeof(ConfigRecord_t);
+	const ConfigRecord_t *pBest = 0;
+	uint16_t wBestSlot = 0;
+
+	pStore->pDev = pDev;
+	pStore->dwSeq = 0;
+	pStore->wNextSlot = 0;
+	pStore->byActive = CONFIG_NONE;
+
+	for(uint8_t bySector = 0; bySector < 2; bySector++)
+	{
+		for(uint16_t wSlot = 0; wSlot < wSlots; wSlot++)
+		{
+			const ConfigRecord_t *pRecord = configSlot(pStore, bySector, wSlot);
+
+			if(configSlotIsBlank(pRecord))
+			{
+				break;
+			}
+			if(configSlotIsValid(pRecord) && (pBest == 0 || pRecord->dwSeq > pBest->dwSeq))
+			{
+				pBest = pRecord;
+				wBestSlot = wSlot;
+				pStore->byActive = bySector;
+			}
+		}
+	}
+	if(pBest == 0)
+	{
+		return 0;
+	}
+
+	// Ghi tiep sau o da dung cuoi cung, ke ca o bi ghi do
+	pStore->wNextSlot = wBestSlot + 1;
+	while(pStore->wNextSlot < wSlots && \
+		  !configSlotIsBlank(configSlot(pStore, pStore->byActive, pStore->wNextSlot)))
+	{
+		pStore->wNextSlot++;
+	}
+	pStore->dwSeq = pBest->dwSeq;
+	pStore->config = pBest->config;
+	*pConfig = pBest->config;
+	return 1;
+}
+/**
+ * @func   configStoreSave
+ * @brief  Ghi cau hinh moi vao o trong ke tiep. Khi sector day thi xoa sector
+ *         con lai va ghi sang do; sector cu chi bi xoa o lan doi tiep theo
+ * @param  pStore: Kho luu
+ * @param  pConfig: Cau hinh can luu
+ * @retval 0 neu thanh cong (hoac khong co gi thay doi), 1 neu loi flash
+ */
+uint8_t configStoreSave(ConfigStore_t *pStore,const StationConfig_t *pConfig)
+{
+	const FlashDev_t *pDev = pStore->pDev;
+	uint16_t wSlots = pDev->dwSize / sizeof(ConfigRecord_t);
+	ConfigRecord_t record;
+	uint32_t pdwWord[CONFIG_RECORD_WORDS];
+	uintptr_t dwAddr;
+
+	if(pStore->byActive != CONFIG_NONE && \
+	   memcmp(&pStore->config, pConfig, sizeof(StationConfig_t)) == 0)
+	{
+		return 0;
+	}
+
+	if(pStore->byActive == CONFIG_NONE || pStore->wNextSlot >= wSlots)
+	{
+		uint8_t byNext = (pStore->byActive == 0) ? 1 : 0;
+
+		if(pDev->pfErase(pDev->pbySector[byNext]) != 0)
+		{
+			return 1;
+		}
+		pStore->byActive = byNext;
+		pStore->wNextSlot = 0;
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.dwSeq = pStore->dwSeq + 1;
+	record.config = *pConfig;
+	record.dwCrc = configCrc32((const uint8_t *)&record, offsetof(ConfigRecord_t, dwCrc));
+	record.dwMagic = CONFIG_MAGIC;
+	memcpy(pdwWord, &record, sizeof(record));
+
+	dwAddr = (uintptr_t)configSlot(pStore, pStore->byActive, pStore->wNextSlot);
+	pStore->wNextSlot++;
+	for(uint8_t i = 0; i < CONFIG_RECORD_WORDS; i++)
+	{
+		if(pDev->pfProgram(dwAddr + i*4, pdwWord[i]) != 0)
+		{
+			return 1;
+		}
+	}
+
+	pStore->dwSeq = record.dwSeq;
+	pStore->config = *pConfig;
+	return 0;
+}
+/**
+ * @func   configCrc32
+ * @brief  CRC-32 (da thuc 0xEDB88320) tinh theo bit, du nhanh cho vai chuc byte
+ * @param
+ * @retval CRC
+ */
+static uint32_t configCrc32(const uint8_t *pbyData,uint16_t wLen)
+{
+	uint32_t dwCrc = 0xFFFFFFFF;
+
+	while(wLen--)
+	{
+		dwCrc ^= *pbyData++;
+		for(uint8_t i = 0; i < 8; i++)
+		{
+			dwCrc = (dwCrc >> 1) ^ (0xEDB88320 & (0 - (dwCrc & 1)));
+		}
+	}
+	return ~dwCrc;
+}
+/**
+ * @func   configSlot
+ * @brief  Dia chi o ghi thu wSlot trong sector bySector
+ * @param
+ * @retval Con tro toi ban ghi trong flash
+ */
+static const ConfigRecord_t *configSlot(const ConfigStore_t *pStore,uint8_t bySector,uint16_t wSlot)
+{
+	return (const ConfigRecord_t *)(pStore->pDev->pdwBase[bySector] + wSlot*sizeof(ConfigRecord_t));
+}
+/**
+ * @func   configSlotIsBlank
+ * @brief  O ghi chua tung duoc ghi (tat ca word deu la 0xFFFFFFFF)
+ * @param
+ * @retval 1 neu trong
+ */
+static uint8_t configSlotIsBlank(const ConfigRecord_t *pRecord)
+{
+	const uint32_t *pdwWord = (const uint32_t *)pRecord;
+
+	for(uint8_t i = 0; i < CONFIG_RECORD_WORDS; i++)
+	{
+		if(pdwWord[i] != CONFIG_ERASED)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+/**
+ * @func   configSlotIsValid
+ * @brief  O ghi da ghi xong: co magic va CRC dung
+ * @param
+ * @retval 1 neu hop le
+ */
+static uint8_t configSlotIsValid(const ConfigRecord_t *pRecord)
+{
+	return (pRecord->dwMagic == CONFIG_MAGIC) && \
+		   (pRecord->dwCrc == configCrc32((const uint8_t *)pRecord, offsetof(ConfigRecord_t, dwCrc)));
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: config-store.h
+ *
+ * Description: Luu cau hinh tram vao flash theo kieu ghi noi tiep tren 2 sector,
+ *              doi sector khi day, mat dien giua chung van con ban ghi cu.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _CONFIG_STORE_H_
+#define _CONFIG_STORE_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "flash-sector.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+typedef struct {
+	uint8_t		byTestMode;			//Che do test lan cuoi (TestSwMode_e)
+	uint8_t		byAutoDetect;		//1: tu nhan dien che do tu ban tin cua DUT
+	uint8_t		byReserved[2];		//Giu ban ghi chan word
+}StationConfig_t;
+
+typedef struct {
+	const FlashDev_t	*pDev;
+	uint32_t			dwSeq;		//So thu tu ban ghi moi nhat
+	uint16_t			wNextSlot;	//O trong ke tiep trong sector dang dung
+	uint8_t				byActive;	//Sector dang dung (0/1), 0xFF neu chua co
+	StationConfig_t		config;		//Ban sao cau hinh moi nhat
+}ConfigStore_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+uint8_t configStoreInit(ConfigStore_t *pStore,const FlashDev_t *pDev,StationConfig_t *pConfig);
+
+uint8_t configStoreSave(ConfigStore_t *pStore,const StationConfig_t *pConfig);
+
+#endif
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: flash-sector.c
+ *
+ * Description: Xoa sector va ghi word vao flash noi bang thanh ghi FLASH.
+ *              Cac vung flash danh cho du lieu phai khop voi STM32F401RETX_FLASH.ld.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re.h"
+#include "flash-sector.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define FLASH_KEY1							0x45670123
+#define FLASH_KEY2							0xCDEF89AB
+#define FLASH_SR_ERRORS						(FLASH_SR_WRPERR | FLASH_SR_PGAERR | \
+											 FLASH_SR_PGPERR | FLASH_SR_PGSERR)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+const FlashDev_t g_flashDevConfig = {
+	flashSectorErase,
+	flashWordProgram,
+	{FLASH_CONFIG_ADDR_A, FLASH_CONFIG_ADDR_B},
+	{FLASH_CONFIG_SECTOR_A, FLASH_CONFIG_SECTOR_B},
+	FLASH_CONFIG_SECTOR_SIZE
+};
+
+const FlashDev_t g_flashDevLog = {
+	flashSectorErase,
+	flashWordProgram,
+	{FLASH_LOG_ADDR_A, FLASH_LOG_ADDR_B},
+	{FLASH_LOG_SECTOR_A, FLASH_LOG_SECTOR_B},
+	FLASH_LOG_SECTOR_SIZE
+};
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void flashUnlock(void);
+
+static void flashLock(void);
+
+static uint8_t flashWaitReady(void);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   flashSectorErase
+ * @brief  Xoa 1 sector (kieu ghi 32 bit, VDD 2.7-3.6V). CPU bi dung trong luc
+ *         xoa neu dang chay lenh tu flash
+ * @param  bySector: So hieu sector
+ * @retval 0 neu thanh cong, 1 neu loi
+ */
+uint8_t flashSectorErase(uint8_t bySector)
+{
+	uint8_t byErr;
+
+	flashUnlock();
+	flashWaitReady();
+	FLASH->CR &= ~(FLASH_CR_PSIZE | FLASH_CR_SNB);
+	FLASH->CR |= FLASH_CR_PSIZE_1 | FLASH_CR_SER | ((uint32_t)bySector << 3);
+	FLASH->CR |= FLASH_CR_STRT;
+	byErr = flashWaitReady();
+	FLASH->CR &= ~(FLASH_CR_SER | FLASH_CR_SNB);
+	flashLock();
+
+	// Bo dem du lieu co the con giu noi dung cu cua sector vua xoa
+	if(FLASH->ACR & FLASH_ACR_DCEN)
+	{
+		FLASH->ACR &= ~FLASH_ACR_DCEN;
+		FLASH->ACR |= FLASH_ACR_DCRST;
+		FLASH->ACR &= ~FLASH_ACR_DCRST;
+		FLASH->ACR |= FLASH_ACR_DCEN;
+	}
+	return byErr;
+}
+/**
+ * @func   flashWordProgram
+ * @brief  Ghi 1 word vao dia chi da xoa va doc lai de kiem tra
+ * @param  dwAddr: Dia chi (chia het cho 4)
+ * @param  dwData: Du lieu
+ * @retval 0 neu thanh cong, 1 neu loi
+ */
+uint8_t flashWordProgram(uintptr_t dwAddr,uint32_t dwData)
+{
+	uint8_t byErr;
+
+	flashUnlock();
+	flashWaitReady();
+	FLASH->CR &= ~FLASH_CR_PSIZE;
+	FLASH->CR |= FLASH_CR_PSIZE_1 | FLASH_CR_PG;
+	*(volatile uint32_t *)dwAddr = dwData;
+	byErr = flashWaitReady();
+	FLASH->CR &= ~FLASH_CR_PG;
+	flashLock();
+
+	if(byErr == 0 && *(volatile uint32_t *)dwAddr != dwData)
+	{
+		byErr = 1;
+	}
+	return byErr;
+}
+/**
+ * @func   flashUnlock
+ * @brief  Mo khoa thanh ghi FLASH->CR
+ * @param  None
+ * @retval None
+ */
+static void flashUnlock(void)
+{
+	if(FLASH->CR & FLASH_CR_LOCK)
+	{
+		FLASH->KEYR = FLASH_KEY1;
+		FLASH->KEYR = FLASH_KEY2;
+	}
+}
+/**
+ * @func   flashLock
+ * @brief  Khoa lai FLASH->CR
+ * @param  None
+ * @retval None
+ */
+static void flashLock(void)
+{
+	FLASH->CR |= FLASH_CR_LOCK;
+}
+/**
+ * @func   flashWaitReady
+ * @brief  Cho flash xong thao tac, xoa co loi neu co
+ * @param  None
+ * @retval 0 neu khong loi, 1 neu co loi
+ */
+static uint8_t flashWaitReady(void)
+{
+	uint32_t dwStatus;
+
+	while(FLASH->SR & FLASH_SR_BSY);
+	dwStatus = FLASH->SR;
+	if(dwStatus & FLASH_SR_ERRORS)
+	{
+		FLASH->SR = dwStatus & FLASH_SR_ERRORS;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: flash-sector.h
+ *
+ * Description: Xoa sector va ghi word vao flash noi bang thanh ghi FLASH.
+ *              Cac vung flash danh cho du lieu phai khop voi STM32F401RETX_FLASH.ld.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _FLASH_SECTOR_H_
+#define _FLASH_SECTOR_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// Vung CONFIG trong linker script: sector 1 va 2 (16K moi sector)
+#define FLASH_CONFIG_SECTOR_A				1
+#define FLASH_CONFIG_SECTOR_B				2
+#define FLASH_CONFIG_ADDR_A					0x08004000
+#define FLASH_CONFIG_ADDR_B					0x08008000
+#define FLASH_CONFIG_SECTOR_SIZE			0x4000
+// Vung LOG trong linker script: sector 6 va 7 (128K moi sector)
+#define FLASH_LOG_SECTOR_A					6
+#define FLASH_LOG_SECTOR_B					7
+#define FLASH_LOG_ADDR_A					0x08040000
+#define FLASH_LOG_ADDR_B					0x08060000
+#define FLASH_LOG_SECTOR_SIZE				0x20000
+
+// Cac thao tac flash ma config-store/record-log can, tra ve 0 neu thanh cong.
+// Tren host co the thay bang 1 mang RAM gia lap sector (xoa = dat 0xFF, ghi = AND).
+typedef struct {
+	uint8_t		(*pfErase)(uint8_t bySector);
+	uint8_t		(*pfProgram)(uintptr_t dwAddr,uint32_t dwData);
+	uintptr_t	pdwBase[2];			//Dia chi dau 2 sector
+	uint8_t		pbySector[2];		//So hieu 2 sector
+	uint32_t	dwSize;				//Kich thuoc moi sector (byte)
+}FlashDev_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+extern const FlashDev_t g_flashDevConfig;
+
+extern const FlashDev_t g_flashDevLog;
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+uint8_t flashSectorErase(uint8_t bySector);
+
+uint8_t flashWordProgram(uintptr_t dwAddr,uint32_t dwData);
+
+#endif
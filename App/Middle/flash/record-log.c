@@ -0,0 +1,383 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: record-log.c
+ *
+ * Description: Nhat ky ban ghi kich thuoc co dinh, chi ghi noi tiep, xoay vong
+ *              tren 2 sector flash; khoi dong chi doc header sector va tim nhi phan.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "record-log.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LOG_SECTOR_MAGIC					0x4C4F4753	//"LOGS"
+#define LOG_RECORD_MAGIC					0x5245434F	//"RECO"
+#define LOG_NONE							0xFF
+#define LOG_ERASED							0xFFFFFFFF
+
+// Header dau moi sector, magic ghi cuoi cung. Xoa do chi dua bit ve 1 nen
+// co the lam dwGen cua sector cu lon len ma magic van con; dwGenInv = ~dwGen
+// khong the cung bi doi ma van khop
+typedef struct {
+	uint32_t	dwGen;
+	uint32_t	dwRecordSize;
+	uint32_t	dwGenInv;
+	uint32_t	dwMagic;
+}LogHeader_t;
+
+// O ghi: du lieu, crc, magic ghi cuoi cung. O bi ghi do van khong con trong
+// nen viec tim nhi phan o trong dau tien van dung
+typedef struct {
+	uint8_t		pbyPayload[LOG_PAYLOAD_SIZE];
+	uint32_t	dwCrc;
+	uint32_t	dwMagic;
+}LogRecord_t;
+
+#define LOG_RECORD_WORDS					(sizeof(LogRecord_t)/4)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint32_t logCrc32(const uint8_t *pbyData,uint16_t wLen);
+
+static const LogHeader_t *logHeader(const RecordLog_t *pLog,uint8_t bySector);
+
+static const LogRecord_t *logSlot(const RecordLog_t *pLog,uint8_t bySector,uint16_t wSlot);
+
+static uint8_t logSlotIsBlank(const LogRecord_t *pRecord);
+
+static uint8_t logHeaderIsValid(const LogHeader_t *pHeader);
+
+static uint8_t logProgram(const RecordLog_t *pLog,uintptr_t dwAddr,const uint32_t *pdwData,uint8_t byWords);
+
+static uint8_t logStartSector(RecordLog_t *pLog);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   recordLogInit
+ * @brief  Dung lai chi muc luc khoi dong: doc 2 header sector de biet sector
+ *         moi nhat, roi tim nhi phan o trong dau tien trong sector do
+ * @param  pLog: Nhat ky
+ * @param  pDev: Thao tac flash va vi tri 2 sector
+ * @retval None
+ */
+void recordLogInit(RecordLog_t *pLog,const FlashDev_t *pDev)
+{
+	uint8_t pbyValid[2];
+	uint16_t wLow = 0;
+	uint16_t wHigh;
+
+	pLog->pDev = pDev;
+	pLog->wSlots = (pDev->dwSize - sizeof(LogHeader_t)) / sizeof(LogRecord_t);
+	pLog->dwGen = 0;
+	pLog->wNextSlot = 0;
+	pLog->byActive = LOG_NONE;
+	pLog->byUsed = 0;
+	pLog->byNextBlank = 0;
+
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		const LogHeader_t *pHeader = logHeader(pLog, i);
+
+		pbyValid[i] = logHeaderIsValid(pHeader);
+		if(pbyValid[i] && (pLog->byActive == LOG_NONE || pHeader->dwGen > pLog->dwGen))
+		{
+			pLog->byActive = i;
+			pLog->dwGen = pHeader->dwGen;
+		}
+	}
+	if(pLog->byActive == LOG_NONE)
+	{
+		return;
+	}
+
+	// Sector con lai chi la phan cu hon neu dung the he lien truoc
+	pLog->byUsed = 1;
+	if(pbyValid[1 - pLog->byActive] && \
+	   logHeader(pLog, 1 - pLog->byActive)->dwGen + 1 == pLog->dwGen)
+	{
+		pLog->byUsed = 2;
+	}
+
+	wHigh = pLog->wSlots;
+	while(wLow < wHigh)
+	{
+		uint16_t wMid = (wLow + wHigh) / 2;
+
+		if(logSlotIsBlank(logSlot(pLog, pLog->byActive, wMid)))
+		{
+			wHigh = wMid;
+		}else
+		{
+			wLow = wMid + 1;
+		}
+	}
+	pLog->wNextSlot = wLow;
+}
+/**
+ * @func   recordLogAppend
+ * @brief  Ghi 1 ban ghi vao o trong ke tiep. Sector day thi xoa sector con lai
+ *         (mat nua nhat ky cu nhat) va ghi tiep o do; neu recordLogPrepare da
+ *         xoa san thi lan doi sector chi con ghi header
+ * @param  pLog: Nhat ky
+ * @param  pPayload: LOG_PAYLOAD_SIZE byte du lieu
+ * @retval 0 neu thanh cong, 1 neu loi flash
+ */
+uint8_t recordLogAppend(RecordLog_t *pLog,const void *pPayload)
+{
+	LogRecord_t record;
+	uintptr_t dwAddr;
+
+	if(pLog->byActive == LOG_NONE || pLog->wNextSlot >= pLog->wSlots)
+	{
+		if(logStartSector(pLog) != 0)
+		{
+			return 1;
+		}
+	}
+
+	memcpy(record.pbyPayload, pPayload, LOG_PAYLOAD_SIZE);
+	record.dwCrc = logCrc32(record.pbyPayload, LOG_PAYLOAD_SIZE);
+	record.dwMagic = LOG_RECORD_MAGIC;
+
+	dwAddr = (uintptr_t)logSlot(pLog, pLog->byActive, pLog->wNextSlot);
+	pLog->wNextSlot++;
+	return logProgram(pLog, dwAddr, (const uint32_t *)&record, LOG_RECORD_WORDS);
+}
+/**
+ * @func   recordLogPrepare
+ * @brief  Xoa san sector ke tiep khi sector dang ghi con khong qua wSpare o
+ *         trong (hoac chua co sector nao). Xoa 128K chan CPU 1-2 s nen chi goi
+ *         luc ranh, khong goi trong luc dang quyet dinh/ghi ket qua DUT
+ * @param  pLog: Nhat ky
+ * @param  wSpare: So o trong con lai thi bat dau xoa san
+ * @retval 0 neu thanh cong hoac chua can xoa, 1 neu loi flash
+ */
+uint8_t recordLogPrepare(RecordLog_t *pLog,uint16_t wSpare)
+{
+	const FlashDev_t *pDev = pLog->pDev;
+	uint8_t byNext = (pLog->byActive == 0) ? 1 : 0;
+
+	if(pLog->byNextBlank || \
+	   (pLog->byActive != LOG_NONE && pLog->wSlots - pLog->wNextSlot > wSpare))
+	{
+		return 0;
+	}
+	// Nua nhat ky cu nhat mat ngay tu luc bat dau xoa
+	if(pLog->byUsed == 2)
+	{
+		pLog->byUsed = 1;
+	}
+	if(pDev->pfErase(pDev->pbySector[byNext]) != 0)
+	{
+		return 1;
+	}
+	pLog->byNextBlank = 1;
+	return 0;
+}
+/**
+ * @func   recordLogCount
+ * @brief  So o ghi da dung (ke ca o bi ghi do)
+ * @param  pLog: Nhat ky
+ * @retval So o ghi
+ */
+uint32_t recordLogCount(const RecordLog_t *pLog)
+{
+	if(pLog->byUsed == 0)
+	{
+		return 0;
+	}
+	return (uint32_t)(pLog->byUsed - 1) * pLog->wSlots + pLog->wNextSlot;
+}
+/**
+ * @func   recordLogRead
+ * @brief  Doc ban ghi thu dwIdx, 0 la ban ghi cu nhat
+ * @param  pLog: Nhat ky
+ * @param  dwIdx: Thu tu, nho hon recordLogCount
+ * @param  pPayload: Noi chep LOG_PAYLOAD_SIZE byte du lieu
+ * @retval 1 neu ban ghi hop le, 0 neu o bi ghi do hoac ngoai pham vi
+ */
+uint8_t recordLogRead(const RecordLog_t *pLog,uint32_t dwIdx,void *pPayload)
+{
+	uint8_t bySector = pLog->byActive;
+	const LogRecord_t *pRecord;
+
+	if(dwIdx >= recordLogCount(pLog))
+	{
+		return 0;
+	}
+	if(pLog->byUsed == 2)
+	{
+		if(dwIdx < pLog->wSlots)
+		{
+			bySector = 1 - pLog->byActive;
+		}else
+		{
+			dwIdx -= pLog->wSlots;
+		}
+	}
+
+	pRecord = logSlot(pLog, bySector, (uint16_t)dwIdx);
+	if(pRecord->dwMagic != LOG_RECORD_MAGIC || \
+	   pRecord->dwCrc != logCrc32(pRecord->pbyPayload, LOG_PAYLOAD_SIZE))
+	{
+		return 0;
+	}
+	memcpy(pPayload, pRecord->pbyPayload, LOG_PAYLOAD_SIZE);
+	return 1;
+}
+/**
+ * @func   logStartSector
+ * @brief  Xoa sector ke tiep (neu chua xoa san) va ghi header the he moi
+ * @param  pLog: Nhat ky
+ * @retval 0 neu thanh cong, 1 neu loi flash
+ */
+static uint8_t logStartSector(RecordLog_t *pLog)
+{
+	const FlashDev_t *pDev = pLog->pDev;
+	uint8_t byNext = (pLog->byActive == 0) ? 1 : 0;
+	LogHeader_t header;
+
+	if(!pLog->byNextBlank && pDev->pfErase(pDev->pbySector[byNext]) != 0)
+	{
+		return 1;
+	}
+	pLog->byNextBlank = 0;
+	header.dwGen = pLog->dwGen + 1;
+	header.dwRecordSize = sizeof(LogRecord_t);
+	header.dwGenInv = ~header.dwGen;
+	header.dwMagic = LOG_SECTOR_MAGIC;
+	if(logProgram(pLog, pDev->pdwBase[byNext], (const uint32_t *)&header, sizeof(header)/4) != 0)
+	{
+		return 1;
+	}
+
+	pLog->byUsed = (pLog->byActive == LOG_NONE) ? 1 : 2;
+	pLog->byActive = byNext;
+	pLog->dwGen = header.dwGen;
+	pLog->wNextSlot = 0;
+	return 0;
+}
+/**
+ * @func   logProgram
+ * @brief  Ghi lan luot cac word, word cuoi (magic) ghi sau cung
+ * @param
+ * @retval 0 neu thanh cong, 1 neu loi flash
+ */
+static uint8_t logProgram(const RecordLog_t *pLog,uintptr_t dwAddr,const uint32_t *pdwData,uint8_t byWords)
+{
+	for(uint8_t i = 0; i < byWords; i++)
+	{
+		if(pLog->pDev->pfProgram(dwAddr + i*4, pdwData[i]) != 0)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+/**
+ * @func   logCrc32
+ * @brief  CRC-32 (da thuc 0xEDB88320) tinh theo bit
+ * @param
+ * @retval CRC
+ */
+static uint32_t logCrc32(const uint8_t *pbyData,uint16_t wLen)
+{
+	uint32_t dwCrc = 0xFFFFFFFF;
+
+	while(wLen--)
+	{
+		dwCrc ^= *pbyData++;
+		for(uint8_t i = 0; i < 8; i++)
+		{
+			dwCrc = (dwCrc >> 1) ^ (0xEDB88320 & (0 - (dwCrc & 1)));
+		}
+	}
+	return ~dwCrc;
+}
+/**
+ * @func   logHeader
+ * @brief  Header cua sector bySector
+ * @param
+ * @retval Con tro toi header trong flash
+ */
+static const LogHeader_t *logHeader(const RecordLog_t *pLog,uint8_t bySector)
+{
+	return (const LogHeader_t *)pLog->pDev->pdwBase[bySector];
+}
+/**
+ * @func   logSlot
+ * @brief  O ghi thu wSlot trong sector bySector (ngay sau header)
+ * @param
+ * @retval Con tro toi o ghi trong flash
+ */
+static const LogRecord_t *logSlot(const RecordLog_t *pLog,uint8_t bySector,uint16_t wSlot)
+{
+	return (const LogRecord_t *)(pLog->pDev->pdwBase[bySector] + sizeof(LogHeader_t) + \
+								 (uint32_t)wSlot*sizeof(LogRecord_t));
+}
+/**
+ * @func   logSlotIsBlank
+ * @brief  O ghi chua tung duoc ghi
+ * @param
+ * @retval 1 neu trong
+ */
+static uint8_t logSlotIsBlank(const LogRecord_t *pRecord)
+{
+	const uint32_t *pdwWord = (const uint32_t *)pRecord;
+
+	for(uint8_t i = 0; i < LOG_RECORD_WORDS; i++)
+	{
+		if(pdwWord[i] != LOG_ERASED)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+/**
+ * @func   logHeaderIsValid
+ * @brief  Header da ghi xong va khong bi xoa do: magic, kich thuoc o ghi va
+ *         cap dwGen/dwGenInv khop nhau
+ * @param
+ * @retval 1 neu hop le
+ */
+static uint8_t logHeaderIsValid(const LogHeader_t *pHeader)
+{
+	return (pHeader->dwMagic == LOG_SECTOR_MAGIC) && \
+		   (pHeader->dwRecordSize == sizeof(LogRecord_t)) && \
+		   (pHeader->dwGenInv == ~pHeader->dwGen);
+}
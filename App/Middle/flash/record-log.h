@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: record-log.h
+ *
+ * Description: Nhat ky ban ghi kich thuoc co dinh, chi ghi noi tiep, xoay vong
+ *              tren 2 sector flash; khoi dong chi doc header sector va tim nhi phan.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _RECORD_LOG_H_
+#define _RECORD_LOG_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "flash-sector.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LOG_PAYLOAD_SIZE					40		//Chia het cho 4
+
+typedef struct {
+	const FlashDev_t	*pDev;
+	uint32_t			dwGen;		//The he cua sector dang ghi, tang moi lan doi sector
+	uint16_t			wSlots;		//So o ghi moi sector
+	uint16_t			wNextSlot;	//O trong ke tiep trong sector dang ghi
+	uint8_t				byActive;	//Sector dang ghi (0/1), 0xFF neu chua co
+	uint8_t				byUsed;		//So sector dang chua ban ghi (0..2)
+	uint8_t				byNextBlank;//Sector ke tiep da duoc xoa san (recordLogPrepare)
+}RecordLog_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void recordLogInit(RecordLog_t *pLog,const FlashDev_t *pDev);
+
+uint8_t recordLogAppend(RecordLog_t *pLog,const void *pPayload);
+
+uint8_t recordLogPrepare(RecordLog_t *pLog,uint16_t wSpare);
+
+uint32_t recordLogCount(const RecordLog_t *pLog);
+
+uint8_t recordLogRead(const RecordLog_t *pLog,uint32_t dwIdx,void *pPayload);
+
+#endif
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: menu-widget.c
+ *
+ * Description: Menu khong chan: tu luu bo cuc, moi lan chi xu ly 1 phim va
+ *              di chuyen khung chon bang cac doan to mau.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "lcd.h"
+#include "GUI.h"
+#include "lcd-seq.h"
+#include "gui-span.h"
+#include "menu-widget.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define MENU_WIDGET_FIRST_ROW				30
+#define MENU_WIDGET_ROW_GAP					10
+#define MENU_WIDGET_BOX_XS					10
+#define MENU_WIDGET_BOX_XE					230
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static void menuWidgetDrawBox(MenuWidget_t *pMenu,uint8_t byRow,u16 wColor);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   menuWidgetInit
+ * @brief  Khoi tao menu va tinh truoc toa do cac dong
+ * @param  pMenu: Menu
+ * @param  pcTitle: Tieu de
+ * @param  ppcOption, byNumOfRows: Cac lua chon va so luong
+ * @param  bySizeOfRow: Chieu cao moi dong
+ * @retval None
+ */
+void menuWidgetInit(MenuWidget_t *pMenu,const char *pcTitle,const char * const *ppcOption,\
+					uint8_t byNumOfRows,uint8_t bySizeOfRow)
+{
+	if(byNumOfRows > MENU_WIDGET_MAX_ROWS)
+	{
+		byNumOfRows = MENU_WIDGET_MAX_ROWS;
+	}
+	pMenu->pcTitle = pcTitle;
+	pMenu->ppcOption = ppcOption;
+	pMenu->byNumOfRows = byNumOfRows;
+	pMenu->bySizeOfRow = bySizeOfRow;
+	pMenu->byRow = 0;
+	for(uint8_t i = 0; i < byNumOfRows; i++)
+	{
+		pMenu->pwRowY[i] = MENU_WIDGET_FIRST_ROW + i*(bySizeOfRow + MENU_WIDGET_ROW_GAP);
+	}
+}
+/**
+ * @func   menuWidgetShow
+ * @brief  Ve toan bo menu, chi goi khi vao menu
+ * @param  pMenu: Menu
+ * @retval None
+ */
+void menuWidgetShow(MenuWidget_t *pMenu)
+{
+	LCD_SeqFill(0, 0, lcddev.width - 1, lcddev.height - 1, WHITE);
+	LCD_ShowTitle(pMenu->bySizeOfRow, WHITE, BLUE, (u8 *)pMenu->pcTitle, 16, 1);
+	for(uint8_t i = 0; i < pMenu->byNumOfRows; i++)
+	{
+		LCD_ShowOption(20, pMenu->pwRowY[i], BLACK, CYAN, (u8 *)pMenu->ppcOption[i], 16, 1);
+	}
+	LCD_SeqInvalidate();
+	menuWidgetDrawBox(pMenu, pMenu->byRow, BLACK);
+}
+/**
+ * @func   menuWidgetProcess
+ * @brief  Xu ly 1 phim roi tra ve ngay, khong cho phim. UP/DOWN chi xoa khung
+ *         cu va ve khung moi
+ * @param  pMenu: Menu
+ * @param  key: Phim vua nhan (NOKEY neu khong co)
+ * @retval Dong duoc chon, tu 1; 0 neu chua chon
+ */
+uint8_t menuWidgetProcess(MenuWidget_t *pMenu,ValueKey_e key)
+{
+	uint8_t byRow = 0;
+
+	switch(key)
+	{
+	case UP:
+		menuWidgetDrawBox(pMenu, pMenu->byRow, CYAN);
+		pMenu->byRow = (pMenu->byRow == 0) ? pMenu->byNumOfRows - 1 : pMenu->byRow - 1;
+		menuWidgetDrawBox(pMenu, pMenu->byRow, BLACK);
+		break;
+	case DOWN:
+		menuWidgetDrawBox(pMenu, pMenu->byRow, CYAN);
+		pMenu->byRow = (pMenu->byRow + 1 >= pMenu->byNumOfRows) ? 0 : pMenu->byRow + 1;
+		menuWidgetDrawBox(pMenu, pMenu->byRow, BLACK);
+		break;
+	case SELECT:
+		byRow = pMenu->byRow + 1;
+		menuWidgetSelect(pMenu, byRow);
+		break;
+	default:
+		break;
+	}
+	return byRow;
+}
+/**
+ * @func   menuWidgetSelect
+ * @brief  Chon 1 dong ma khong can phim (vd. lay tu cau hinh da luu): xoa man
+ *         hinh va hien ten dong duoc chon lam tieu de
+ * @param  pMenu: Menu
+ * @param  byRow: Dong duoc chon, tu 1
+ * @retval None
+ */
+void menuWidgetSelect(MenuWidget_t *pMenu,uint8_t byRow)
+{
+	pMenu->byRow = byRow - 1;
+	LCD_SeqFill(0, 0, lcddev.width - 1, lcddev.height - 1, WHITE);
+	menuWidgetShowTitle(pMenu);
+}
+/**
+ * @func   menuWidgetShowTitle
+ * @brief  Ve lai thanh tieu de voi ten dong dang chon (sau khi bi ghi de)
+ * @param  pMenu: Menu
+ * @retval None
+ */
+void menuWidgetShowTitle(MenuWidget_t *pMenu)
+{
+	LCD_ShowTitle(pMenu->bySizeOfRow, WHITE, BLUE, (u8 *)pMenu->ppcOption[pMenu->byRow], 16, 1);
+	LCD_SeqInvalidate();
+}
+/**
+ * @func   menuWidgetDrawBox
+ * @brief  Ve khung chon quanh 1 dong bang 4 doan to mau (2 ngang, 2 doc)
+ * @param
+ * @retval None
+ */
+static void menuWidgetDrawBox(MenuWidget_t *pMenu,uint8_t byRow,u16 wColor)
+{
+	u16 wYs = pMenu->pwRowY[byRow];
+	u16 wYe = wYs + pMenu->bySizeOfRow;
+
+	guiSpanRect(MENU_WIDGET_BOX_XS, wYs, MENU_WIDGET_BOX_XE, wYe, wColor);
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: menu-widget.h
+ *
+ * Description: Menu khong chan: tu luu bo cuc, moi lan chi xu ly 1 phim va
+ *              di chuyen khung chon bang cac doan to mau.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _MENU_WIDGET_H_
+#define _MENU_WIDGET_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "lcd.h"
+#include "button-v1-1.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define MENU_WIDGET_MAX_ROWS				8
+
+typedef struct {
+	const char			*pcTitle;
+	const char * const	*ppcOption;
+	uint8_t				byNumOfRows;
+	uint8_t				bySizeOfRow;
+	uint8_t				byRow;							//Dong dang chon, tu 0
+	u16					pwRowY[MENU_WIDGET_MAX_ROWS];	//Toa do y cua tung dong
+}MenuWidget_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void menuWidgetInit(MenuWidget_t *pMenu,const char *pcTitle,const char * const *ppcOption,\
+					uint8_t byNumOfRows,uint8_t bySizeOfRow);
+
+void menuWidgetShow(MenuWidget_t *pMenu);
+
+uint8_t menuWidgetProcess(MenuWidget_t *pMenu,ValueKey_e key);
+
+void menuWidgetSelect(MenuWidget_t *pMenu,uint8_t byRow);
+
+void menuWidgetShowTitle(MenuWidget_t *pMenu);
+
+#endif
@@ -0,0 +1,279 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: dut-session.c
+ *
+ * Description: Phien test 1 kenh DUT: gom ban tin ZigBee/BLE/MCU cua DUT va
+ *              quyet dinh dat/loi theo so endpoint. Khong ve, khong ghi log: cac
+ *              quyet dinh bao ra qua callback nen chay duoc tren may host.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <string.h>
+#include "mac-set.h"
+#include "dut-session.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint32_t versionFromBytes(const uint8_t *pbyVersion);
+
+static void dutSessionEmit(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd);
+
+static void dutSessionFail(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   dutSessionInit
+ * @brief  Xoa phien test cua 1 kenh
+ * @param  pSess: Phien test
+ * @param  byChannel: So kenh
+ * @param  pEvent: Ham xu ly su kien DUT_EVENT_xxx
+ * @retval None
+ */
+void dutSessionInit(DutSession_t *pSess,uint8_t byChannel,dut_session_event pEvent)
+{
+	memset(pSess, 0, sizeof(*pSess));
+	pSess->byChannel = byChannel;
+	pSess->pHandleEvent = pEvent;
+}
+/**
+ * @func   dutSessionOnMcu
+ * @brief  Luu thong tin MCU (so nut, loai, version) cua DUT
+ * @param  pSess: Phien test
+ * @param  pCmd: Ban tin MCU
+ * @retval None
+ */
+void dutSessionOnMcu(DutSession_t *pSess,const McuInfor_t *pCmd)
+{
+	pSess->byEndpointCntMCU = pCmd->endpoint_cnt;
+
+	pSess->byTypeMCU = pCmd->type;
+
+	pSess->dwVersionMCU = versionFromBytes(pCmd->version);
+	pSess->byFieldRx |= SESS_RX_VER_MCU;
+
+	memcpy(pSess->prodRecord.pbyVerMCU, pCmd->version, LENGTH_OF_VERSION);
+	pSess->prodRecord.byTypeMCU = pCmd->type;
+	pSess->prodRecord.byButton = pCmd->endpoint_cnt;
+}
+/**
+ * @func   dutSessionOnRadio
+ * @brief  Luu thong tin ZigBee/BLE cua DUT; quet du 2 ban tin thi so sanh
+ *         endpoint voi MCU: khop la DAT, lech thi quet lai 1 lan roi bao LOI
+ * @param  pSess: Phien test
+ * @param  pCmd: Ban tin ZigBee/BLE
+ * @param  mode: Che do test
+ * @retval None
+ */
+void dutSessionOnRadio(DutSession_t *pSess,const CmdData_t *pCmd,TestSwMode_e mode)
+{
+	uint64_t qwMAC = macFromBytes(pCmd->pbyMAC);
+	uint64_t qwMACTest;
+	uint8_t byMatch;
+	uint8_t byReady = 1;
+
+	//5. Quet 2 lan de lay version cua zigbee va bluetooth
+	if(pCmd->protocolType == PROTOCOL_TYPE_ZIGBEE)
+	{
+		pSess->byStatusCnt ++;
+		pSess->dwVersionZigBee = versionFromBytes(pCmd->pbyVersion);
+		pSess->byFieldRx |= SESS_RX_VER_ZIGBEE;
+		pSess->qwMACZigbee = qwMAC;
+		pSess->byEndpointCntZigBee = pCmd->byEndpointCnt;
+
+		getModelID(pSess->pcModelID, pCmd->pbyInFor);
+
+		memcpy(pSess->prodRecord.pbyVerZigbee, pCmd->pbyVersion, LENGTH_OF_VERSION);
+		memset(pSess->prodRecord.pcModelID, 0, sizeof(pSess->prodRecord.pcModelID));
+		strncpy(pSess->prodRecord.pcModelID, pSess->pcModelID, sizeof(pSess->prodRecord.pcModelID) - 1);
+		if(mode != BLE_MODE)
+		{
+			memcpy(pSess->prodRecord.pbyMAC, pCmd->pbyMAC, LENGTH_OF_MAC);
+		}
+
+	}else if(pCmd->protocolType == PROTOCOL_TYPE_BLUETOOTH)
+	{
+		pSess->byStatusCnt ++;
+		pSess->dwVersionBluetooth = versionFromBytes(pCmd->pbyVersion);
+		pSess->byFieldRx |= SESS_RX_VER_BLE;
+		pSess->qwMACBle = qwMAC;
+		pSess->byEndpointCntBLE = pCmd->byEndpointCnt;
+
+		pSess->wPID = ((uint16_t)pCmd->pbyInFor[0] << 8) | pCmd->pbyInFor[1];
+		pSess->byFieldRx |= SESS_RX_PID;
+
+		memcpy(pSess->prodRecord.pbyVerBle, pCmd->pbyVersion, LENGTH_OF_VERSION);
+		memcpy(pSess->prodRecord.pbyPID, pCmd->pbyInFor, LENGTH_OF_PID);
+		if(mode == BLE_MODE)
+		{
+			memcpy(pSess->prodRecord.pbyMAC, pCmd->pbyMAC, LENGTH_OF_MAC);
+		}
+	}
+
+	//6. Reset buffer khi mac thay doi
+	if((MAC_LOW48(pSess->qwMACZigbee) != MAC_LOW48(pSess->qwMACLast))||\
+	   (MAC_LOW48(pSess->qwMACBle) != MAC_LOW48(pSess->qwMACLast)))
+	{
+		if(pSess->byFlagOfBufReset == 0)
+		{
+			dutSessionEmit(pSess, DUT_EVENT_NEW_DUT, pCmd);
+			pSess->byEndpointCntMCU = 0;
+			pSess->byFieldRx &= ~(SESS_RX_VER_ZIGBEE | SESS_RX_VER_BLE);
+			pSess->byFlagOfBufReset = 1;
+		}
+	}
+
+	//7. Quet du thong tin cua DUT moi thi so sanh endpoint voi MCU
+	switch(mode)
+	{
+	case DUAL_MODE:
+		qwMACTest = pSess->qwMACZigbee;
+		//Mat 1 ban tin thi so nut ben kia con la cua DUT truoc: cho du 2 ben
+		byReady = (MAC_LOW48(pSess->qwMACZigbee) == MAC_LOW48(pSess->qwMACBle));
+		byMatch = (pSess->byEndpointCntMCU == pSess->byEndpointCntBLE) && \
+				  (pSess->byEndpointCntMCU == pSess->byEndpointCntZigBee);
+		break;
+	case ZIGBEE_MODE:
+		qwMACTest = pSess->qwMACZigbee;
+		byMatch = (pSess->byEndpointCntMCU == pSess->byEndpointCntZigBee);
+		break;
+	case BLE_MODE:
+		qwMACTest = pSess->qwMACBle;
+		byMatch = (pSess->byEndpointCntMCU == pSess->byEndpointCntBLE);
+		break;
+	default:
+		qwMACTest = pSess->qwMACLast;
+		byMatch = 0;
+		break;
+	}
+
+	if(byReady && (MAC_LOW48(qwMACTest) != MAC_LOW48(pSess->qwMACLast)) && (pSess->byStatusCnt >= 2))
+	{
+		pSess->qwMACLast = qwMAC;
+
+		if(byMatch)
+		{
+			dutSessionEmit(pSess, DUT_EVENT_PASS, pCmd);
+
+			pSess->byFlagOfBufReset = 0;
+			pSess->byRetryCnt = 0;
+			pSess->byEndpointCntMCU = 0;
+			pSess->byEndpointCntBLE = 0;
+			pSess->byEndpointCntZigBee = 0;
+		}else if(pSess->byRetryCnt == 0)
+		{
+			//7.1 Endpoint lech thi cho quet lai lan nua
+			pSess->qwMACLast = 0;
+			pSess->byStatusCnt = 0;
+			pSess->byRetryCnt ++;
+		}else if(mode == DUAL_MODE)
+		{
+			//7.2 Firmware loi: Dual mode bao 1 lan, ghi ro ben nao lech
+			if(pSess->byEndpointCntMCU == pSess->byEndpointCntZigBee)
+			{
+				dutSessionFail(pSess, DUT_EVENT_FAIL_BLE, pCmd);
+			}else if(pSess->byEndpointCntMCU == pSess->byEndpointCntBLE)
+			{
+				dutSessionFail(pSess, DUT_EVENT_FAIL_ZIGBEE, pCmd);
+			}else
+			{
+				dutSessionFail(pSess, DUT_EVENT_FAIL_BOTH, pCmd);
+			}
+		}else
+		{
+			dutSessionFail(pSess, (mode == BLE_MODE) ? DUT_EVENT_FAIL_BLE : DUT_EVENT_FAIL_ZIGBEE, pCmd);
+		}
+	}
+
+	if(pSess->byStatusCnt >= 2)
+	{
+		pSess->byStatusCnt = 0;
+	}
+}
+/**
+ * @func   getModelID
+ * @brief  Lay chuoi Model ID tu truong pbyInFor cua ban tin ZigBee
+ * @param  pOutPut: Chuoi ra, toi thieu 20 byte
+ * @param  pInPut: pbyInFor, byte dau la do dai
+ * @retval None
+ */
+void getModelID(char * pOutPut,const uint8_t *pInPut)
+{
+	//pInPut[0] la do dai, toi da 19 ky tu trong pbyInFor[20]
+	uint8_t byLen = (pInPut[0] < 19) ? pInPut[0] : 19;
+
+	memcpy(pOutPut, &pInPut[1], byLen);
+	pOutPut[byLen] = 0;
+}
+/**
+ * @func   versionFromBytes
+ * @brief  Dong goi 3 byte version thanh 0x00MMmmpp
+ * @param  pbyVersion: 3 byte version
+ * @retval Version dong goi
+ */
+static uint32_t versionFromBytes(const uint8_t *pbyVersion)
+{
+	return ((uint32_t)pbyVersion[0] << 16) | ((uint32_t)pbyVersion[1] << 8) | pbyVersion[2];
+}
+/**
+ * @func   dutSessionEmit
+ * @brief  Bao su kien cho ham xu ly cua kenh
+ * @param  pSess: Phien test
+ * @param  event: Su kien
+ * @param  pCmd: Ban tin vua nhan
+ * @retval None
+ */
+static void dutSessionEmit(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd)
+{
+	if(pSess->pHandleEvent != 0)
+	{
+		pSess->pHandleEvent(pSess, event, pCmd);
+	}
+}
+/**
+ * @func   dutSessionFail
+ * @brief  Bao DUT loi roi xoa version/PID de DUT sau khong in nham
+ * @param  pSess: Phien test
+ * @param  event: DUT_EVENT_FAIL_xxx
+ * @param  pCmd: Ban tin vua nhan
+ * @retval None
+ */
+static void dutSessionFail(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd)
+{
+	dutSessionEmit(pSess, event, pCmd);
+	pSess->byFieldRx &= ~(SESS_RX_VER_ZIGBEE | SESS_RX_VER_BLE | SESS_RX_PID);
+	pSess->byRetryCnt = 0;
+}
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: dut-session.h
+ *
+ * Description: Phien test 1 kenh DUT: gom ban tin ZigBee/BLE/MCU cua DUT va
+ *              quyet dinh dat/loi theo so endpoint. Khong ve, khong ghi log: cac
+ *              quyet dinh bao ra qua callback nen chay duoc tren may host.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _DUT_SESSION_H_
+#define _DUT_SESSION_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "menu.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define LENGTH_OF_MAC							8
+#define LENGTH_OF_VERSION						3
+#define LENGTH_OF_DEVICE_TYPE					1
+#define LENGTH_OF_PID							2
+
+#define CMD_ID_ZIGBEE_AND_BLE				0xFF
+#define CMD_ID_MCU_TOUCH					0xAB
+#define MAC_LOW48(mac)						((mac) & 0xFFFFFFFFFFFFULL)
+
+// Truong da nhan tu DUT (DutSession_t.byFieldRx): version 0.0.0 va PID 0 van
+// la gia tri hop le nen khong dung 0 de danh dau "chua nhan"
+#define SESS_RX_VER_ZIGBEE					0x01
+#define SESS_RX_VER_BLE						0x02
+#define SESS_RX_VER_MCU						0x04
+#define SESS_RX_PID							0x08
+
+// Truong protocol trong khung CMD_ID 0xFF
+typedef enum {
+	PROTOCOL_TYPE_ZIGBEE     = 0x00,
+	PROTOCOL_TYPE_BLUETOOTH	 = 0x01,
+	PROTOCOL_TYPE_ZWAVE		 = 0x02
+}ProtocolType_e;
+
+typedef enum {
+	UN_PROVISION			= 0x00,
+	PROVISIONING			= 0x01,
+	PROVISIONED				= 0x02
+}ProvisionState_e;
+
+typedef struct {
+	uint8_t 			byCmdId;
+	uint8_t				protocolType;
+	uint8_t				deviceType;
+	uint8_t				byEndpointCnt;
+	ProvisionState_e	provisonState;
+	uint8_t				pbyMAC[8];
+	uint8_t				pbyVersion[3];
+	uint8_t				pbyInFor[20];
+}CmdData_t;
+
+typedef struct {
+    uint8_t		cmd_id;
+    uint8_t  	msg_from;
+    uint8_t  	version[3];
+    uint8_t  	type;
+    uint8_t  	endpoint_cnt;
+    uint8_t  	led_intensity;
+    uint8_t  	full_port;
+    uint8_t  	relay_type;
+    uint8_t  	cz_type[4];
+    uint8_t  	c_Xor;
+}McuInfor_t;
+
+// Ket qua test 1 DUT, ghi vao record-log
+typedef enum {
+	DUT_RESULT_PASS			= 0x00,
+	DUT_RESULT_FAIL_ZIGBEE	= 0x01,
+	DUT_RESULT_FAIL_BLE		= 0x02,
+	DUT_RESULT_DUPLICATE	= 0x03,
+	DUT_RESULT_FAIL_BOTH	= 0x04
+}DutResult_e;
+
+// Ban ghi nhi phan cua 1 DUT, vua 1 o LOG_PAYLOAD_SIZE byte
+typedef struct {
+	uint8_t		pbyMAC[LENGTH_OF_MAC];
+	uint8_t		pbyVerZigbee[LENGTH_OF_VERSION];
+	uint8_t		pbyVerBle[LENGTH_OF_VERSION];
+	uint8_t		pbyVerMCU[LENGTH_OF_VERSION];
+	uint8_t		pbyPID[LENGTH_OF_PID];
+	uint8_t		byMode;
+	uint8_t		byResult;
+	uint8_t		byTypeMCU;
+	uint8_t		byButton;
+	char		pcModelID[17];
+}ProdRecord_t;
+
+// Su kien cua phien, bao ra dung tai diem quyet dinh (truoc khi xoa bo dem)
+typedef enum {
+	DUT_EVENT_NEW_DUT,			// MAC doi: bo cac byte cu cua kenh
+	DUT_EVENT_PASS,
+	DUT_EVENT_FAIL_BLE,
+	DUT_EVENT_FAIL_ZIGBEE,
+	DUT_EVENT_FAIL_BOTH			// Dual mode: ca ZigBee va BLE lech so nut MCU
+}DutEvent_e;
+
+struct DutSession;
+
+// pCmd la ban tin ZigBee/BLE vua lam phat sinh su kien
+typedef void (*dut_session_event)(struct DutSession *pSess,DutEvent_e event,const CmdData_t *pCmd);
+
+// Trang thai test cua 1 kenh DUT; moi kenh 1 ban, logic quyet dinh chi
+// lam viec tren con tro phien nen chay duoc nhieu kenh doc lap
+typedef struct DutSession {
+	uint8_t			byChannel;
+	uint8_t			byEndpointCntMCU;
+	uint8_t			byEndpointCntBLE;
+	uint8_t			byEndpointCntZigBee;
+	uint8_t			byTypeMCU;
+	// MAC 64 bit va version dong goi 0x00MMmmpp
+	uint64_t		qwMACZigbee;
+	uint64_t		qwMACBle;
+	uint64_t		qwMACLast;
+	uint32_t		dwVersionBluetooth;
+	uint32_t		dwVersionZigBee;
+	uint32_t		dwVersionMCU;
+	uint16_t		wPID;
+	uint8_t			byFieldRx;			// Cac bit SESS_RX_xxx
+	char			pcModelID[20];
+	uint8_t			byStatusCnt;		// So ban tin ZigBee/BLE da quet trong 1 luot
+	uint8_t			byRetryCnt;			// So lan quet lai khi endpoint lech
+	uint8_t			byFlagOfBufReset;
+	ProdRecord_t	prodRecord;			// Ban ghi nhi phan cua DUT dang test
+	dut_session_event	pHandleEvent;
+}DutSession_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void dutSessionInit(DutSession_t *pSess,uint8_t byChannel,dut_session_event pEvent);
+
+void dutSessionOnRadio(DutSession_t *pSess,const CmdData_t *pCmd,TestSwMode_e mode);
+
+void dutSessionOnMcu(DutSession_t *pSess,const McuInfor_t *pCmd);
+
+void getModelID(char * pOutPut,const uint8_t *pInPut);
+
+#endif
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: uart-channel.c
+ *
+ * Description: Kenh nhan UART theo doi tuong: moi kenh co bo dem vong va bo
+ *              phan tich khung rieng, dung cho cong DUT thu 2 (USART1).
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_gpio.h"
+#include "stm32f401re_usart.h"
+#include "misc.h"
+#include "ram-func.h"
+#include "cycle-count.h"
+#include "swar-kernels.h"
+#include "serial-uart.h"
+#include "uart-channel.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+// Cong DUT thu 2: USART1 RX tren PA10, cung toc do voi USART6
+#define UART_AUX_USART						USART1
+#define UART_AUX_RCC						RCC_APB2Periph_USART1
+#define UART_AUX_IRQn						USART1_IRQn
+#define UART_AUX_GPIO_RCC					RCC_AHB1Periph_GPIOA
+#define UART_AUX_PORT						GPIOA
+#define UART_AUX_PIN_RX						GPIO_Pin_10
+#define UART_AUX_PINSOURCE_RX				GPIO_PinSource10
+#define UART_AUX_AF							GPIO_AF_USART1
+
+// Khung: 0x4C 0x4D LEN [LEN-1 byte] CXOR, CXOR la XOR cac byte sau LEN
+#define UART_CH_BYTE_START_1				0x4C
+#define UART_CH_BYTE_START_2				0x4D
+#define UART_CH_RING_MASK					(UART_CH_RX_BUF_SIZE - 1)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+UartChannel_t g_uartChannelAux;
+CycleProbe_t g_cycleUartAuxIsr;
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+static uint8_t uartChannelParse(UartChannel_t *pCh,uint8_t byData);
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   uartChannelInit
+ * @brief  Khoi tao bo dem va bo phan tich cua 1 kenh
+ * @param  pCh: Kenh
+ * @param  byChannel: So kenh, tra lai trong callback
+ * @param  pEvent: Ham xu ly khung
+ * @retval None
+ */
+void uartChannelInit(UartChannel_t *pCh,uint8_t byChannel,uart_channel_event pEvent)
+{
+	pCh->byChannel = byChannel;
+	pCh->pHandleEvent = pEvent;
+	pCh->wFrameCnt = 0;
+	pCh->wErrorCnt = 0;
+	pCh->wDropCnt = 0;
+	uartChannelReset(pCh);
+}
+/**
+ * @func   uartChannelPutByte
+ * @brief  Dua 1 byte vao bo dem vong, goi trong ngat RX. Bo dem day thi bo
+ *         byte va dem vao wDropCnt
+ * @param  pCh: Kenh
+ * @param  byData: Byte nhan duoc
+ * @retval None
+ */
+RAMFUNC void uartChannelPutByte(UartChannel_t *pCh,uint8_t byData)
+{
+	uint16_t wHead = pCh->wHead;
+
+	if((uint16_t)(wHead - pCh->wTail) >= UART_CH_RX_BUF_SIZE)
+	{
+		pCh->wDropCnt++;
+		return;
+	}
+	pCh->pbyRing[wHead & UART_CH_RING_MASK] = byData;
+	pCh->wHead = wHead + 1;
+}
+/**
+ * @func   uartChannelReset
+ * @brief  Bo du lieu dang cho trong bo dem va dua bo phan tich ve dau khung
+ * @param  pCh: Kenh
+ * @retval None
+ */
+void uartChannelReset(UartChannel_t *pCh)
+{
+	pCh->wTail = pCh->wHead;
+	pCh->eRxState = UART_CH_RX_START_1;
+	pCh->wRxIndex = 0;
+}
+/**
+ * @func   uartChannelProcess
+ * @brief  Goi trong vong lap chinh: phan tich cac byte da nhan, moi lan goi
+ *         xu ly toi da 1 khung de cac kenh khac khong phai cho
+ * @param  pCh: Kenh
+ * @retval 1 neu vua xu ly 1 khung
+ */
+uint8_t uartChannelProcess(UartChannel_t *pCh)
+{
+	while(pCh->wTail != pCh->wHead)
+	{
+		uint8_t byData = pCh->pbyRing[pCh->wTail & UART_CH_RING_MASK];
+
+		pCh->wTail++;
+		if(uartChannelParse(pCh, byData))
+		{
+			pCh->wFrameCnt++;
+			if(pCh->pHandleEvent != 0)
+			{
+				pCh->pHandleEvent(pCh->byChannel, &pCh->pbyFrame[1]);
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+/**
+ * @func   uartChannelAuxInit
+ * @brief  Khoi tao cong DUT thu 2 (USART1, chi RX) va kenh g_uartChannelAux
+ * @param  byChannel: So kenh
+ * @param  pEvent: Ham xu ly khung
+ * @retval None
+ */
+void uartChannelAuxInit(uint8_t byChannel,uart_channel_event pEvent)
+{
+	GPIO_InitTypeDef GPIO_InitStruct;
+	USART_InitTypeDef USART_InitStruct;
+	NVIC_InitTypeDef NVIC_InitStruct;
+
+	uartChannelInit(&g_uartChannelAux, byChannel, pEvent);
+
+	//1. GPIO & AF
+	RCC_AHB1PeriphClockCmd(UART_AUX_GPIO_RCC, ENABLE);
+	GPIO_InitStruct.GPIO_Mode = GPIO_Mode_AF;
+	GPIO_InitStruct.GPIO_OType = GPIO_OType_PP;
+	GPIO_InitStruct.GPIO_PuPd = GPIO_PuPd_UP;
+	GPIO_InitStruct.GPIO_Speed = GPIO_Speed_100MHz;
+	GPIO_InitStruct.GPIO_Pin = UART_AUX_PIN_RX;
+	GPIO_Init(UART_AUX_PORT, &GPIO_InitStruct);
+	GPIO_PinAFConfig(UART_AUX_PORT, UART_AUX_PINSOURCE_RX, UART_AUX_AF);
+
+	//2. USART1: Bus APB2
+	RCC_APB2PeriphClockCmd(UART_AUX_RCC, ENABLE);
+	USART_InitStruct.USART_BaudRate = USART6_BAUDRATE;
+	USART_InitStruct.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+	USART_InitStruct.USART_Mode = USART_Mode_Rx;
+	USART_InitStruct.USART_Parity = USART_Parity_No;
+	USART_InitStruct.USART_StopBits = USART_StopBits_1;
+	USART_InitStruct.USART_WordLength = USART_WordLength_8b;
+	USART_Init(UART_AUX_USART, &USART_InitStruct);
+
+	//3. Ngat RX, cung muc uu tien voi USART6
+	NVIC_InitStruct.NVIC_IRQChannel = UART_AUX_IRQn;
+	NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 1;
+	NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+	NVIC_Init(&NVIC_InitStruct);
+
+	USART_Cmd(UART_AUX_USART, ENABLE);
+}
+/**
+ * @func   uartChannelAuxRxCmd
+ * @brief  Bat/tat ngat RX cua cong DUT thu 2
+ * @param  byEnable: 1 de bat
+ * @retval None
+ */
+void uartChannelAuxRxCmd(uint8_t byEnable)
+{
+	USART_ITConfig(UART_AUX_USART, USART_IT_RXNE, byEnable ? ENABLE : DISABLE);
+}
+/**
+ * @func   USART1_IRQHandler
+ * @brief  Nhan byte cua cong DUT thu 2
+ * @param  None
+ * @retval None
+ */
+RAMFUNC void USART1_IRQHandler(void)
+{
+	uint32_t dwStart = CYCLE_NOW();
+
+	if(USART_GetITStatus(UART_AUX_USART, USART_IT_RXNE) == SET)
+	{
+		uartChannelPutByte(&g_uartChannelAux, USART_ReceiveData(UART_AUX_USART));
+	}
+	USART_ClearITPendingBit(UART_AUX_USART, USART_IT_RXNE);
+	CYCLE_PROBE_STOP(g_cycleUartAuxIsr, dwStart);
+}
+/**
+ * @func   uartChannelParse
+ * @brief  May trang thai phan tich khung, giong PollRxBuff cua serial-uart.c
+ *         nhung trang thai nam trong kenh
+ * @param  pCh: Kenh
+ * @param  byData: Byte tiep theo
+ * @retval 1 neu vua nhan du 1 khung dung XOR trong pbyFrame
+ */
+static uint8_t uartChannelParse(UartChannel_t *pCh,uint8_t byData)
+{
+	switch(pCh->eRxState)
+	{
+	case UART_CH_RX_START_1:
+		if(byData == UART_CH_BYTE_START_1)
+		{
+			pCh->eRxState = UART_CH_RX_START_2;
+		}
+		break;
+	case UART_CH_RX_START_2:
+		if(byData == UART_CH_BYTE_START_2)
+		{
+			pCh->wRxIndex = 0;
+			pCh->eRxState = UART_CH_RX_DATA;
+		}else
+		{
+			pCh->eRxState = UART_CH_RX_START_1;
+			pCh->wErrorCnt++;
+		}
+		break;
+	case UART_CH_RX_DATA:
+		//Byte dau la LEN, tinh ca chinh no; LEN = 0 khong hop le
+		if(pCh->wRxIndex == 0 && byData == 0)
+		{
+			pCh->eRxState = UART_CH_RX_START_1;
+			pCh->wErrorCnt++;
+			break;
+		}
+		pCh->pbyFrame[pCh->wRxIndex] = byData;
+		if(++pCh->wRxIndex == pCh->pbyFrame[0])
+		{
+			pCh->eRxState = UART_CH_RX_CXOR;
+		}
+		break;
+	case UART_CH_RX_CXOR:
+		pCh->eRxState = UART_CH_RX_START_1;
+		//XOR ca khung 1 lan khi het du lieu, 4 byte moi lan
+		if(byData == kXorChecksum(&pCh->pbyFrame[1], pCh->wRxIndex - 1))
+		{
+			return 1;
+		}
+		pCh->wErrorCnt++;
+		break;
+	default:
+		pCh->eRxState = UART_CH_RX_START_1;
+		break;
+	}
+	return 0;
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: uart-channel.h
+ *
+ * Description: Kenh nhan UART theo doi tuong: moi kenh co bo dem vong va bo
+ *              phan tich khung rieng, dung cho cong DUT thu 2 (USART1).
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _UART_CHANNEL_H_
+#define _UART_CHANNEL_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+#include "cycle-count.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define UART_CH_RX_BUF_SIZE					256		//Luy thua cua 2
+#define UART_CH_FRAME_MAX					256		//LEN la 1 byte
+
+// Goi khi nhan du 1 khung dung XOR, arg tro vao cac byte sau LEN
+typedef void (*uart_channel_event)(uint8_t byChannel,void *arg);
+
+typedef enum {
+	UART_CH_RX_START_1,
+	UART_CH_RX_START_2,
+	UART_CH_RX_DATA,
+	UART_CH_RX_CXOR
+}UartChRxState_e;
+
+typedef struct {
+	uint8_t				byChannel;
+	volatile uint16_t	wHead;					//Ngat ghi
+	volatile uint16_t	wTail;					//Vong lap chinh doc
+	volatile uint8_t	pbyRing[UART_CH_RX_BUF_SIZE];	//Ngat ghi truoc khi tang wHead
+	UartChRxState_e		eRxState;
+	uint16_t			wRxIndex;
+	uint8_t				pbyFrame[UART_CH_FRAME_MAX];
+	uint16_t			wFrameCnt;				//So khung hop le
+	uint16_t			wErrorCnt;				//So khung sai dinh dang/XOR
+	volatile uint16_t	wDropCnt;				//So byte mat do bo dem day (ngat)
+	uart_channel_event	pHandleEvent;
+}UartChannel_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+extern UartChannel_t g_uartChannelAux;
+extern CycleProbe_t g_cycleUartAuxIsr;		//So chu ky USART1_IRQHandler
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void uartChannelInit(UartChannel_t *pCh,uint8_t byChannel,uart_channel_event pEvent);
+
+void uartChannelPutByte(UartChannel_t *pCh,uint8_t byData);
+
+void uartChannelReset(UartChannel_t *pCh);
+
+uint8_t uartChannelProcess(UartChannel_t *pCh);
+
+void uartChannelAuxInit(uint8_t byChannel,uart_channel_event pEvent);
+
+void uartChannelAuxRxCmd(uint8_t byEnable);
+
+#endif
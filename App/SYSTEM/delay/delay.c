@@ -14,26 +14,25 @@
 #include "sys.h"
 #include "timer.h"
 #include "delay.h"
+#include "timebase.h"
 
 uint32_t dwCalculatorTime(uint32_t dwTimeInit,uint32_t dwTimeCurrent)
 {
-	if(dwTimeCurrent >= dwTimeInit)
-	{
-		return (dwTimeCurrent - dwTimeInit);
-	}else
-	{
-		return (0xFFFFFFFF + dwTimeCurrent - dwTimeInit);
-	}
+	//Tru khong dau da dung ca khi dem vong lai (modulo 2^32)
+	return (dwTimeCurrent - dwTimeInit);
 }
 void delay_ms(u32 nms)
-{	 	 
-	uint32_t dwTimeInit = GetMilSecTick();
-	uint32_t dwTimeCurrent = 0;
-
-	do{
-		dwTimeCurrent = GetMilSecTick();
-	}
-	while(dwCalculatorTime(dwTimeInit, dwTimeCurrent)<nms);
+{
+	//Doc bo dem TIM5 qua thanh ghi volatile, khong phu thuoc bien tick
+	//ngat nen khong bi trinh bien dich (LTO) dua ra ngoai vong lap
+	uint64_t qwDeadline = TimebaseDeadline((uint64_t)nms * TIMEBASE_US_PER_MS);
+	while(!TimebaseExpired(qwDeadline));
+}
+void delay_us(u32 nus)
+{
+	uint64_t qwDeadline = TimebaseDeadline(nus);
+
+	while(!TimebaseExpired(qwDeadline));
 }
 
 
@@ -14,6 +14,7 @@
 #include <sys.h>	  
 
 void delay_ms(u32 nms);
+void delay_us(u32 nus);
 uint32_t dwCalculatorTime(uint32_t dwTimeInit,uint32_t dwTimeCurrent);
 #endif
 
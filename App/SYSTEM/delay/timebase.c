@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: timebase.c
+ *
+ * Description: Dong ho don dieu 64 bit, do phan giai 1 us, tren TIM5 (32 bit)
+ *              mo rong bang ngat tran; API thoi han/thoi gian troi qua.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re_rcc.h"
+#include "stm32f401re_tim.h"
+#include "misc.h"
+#include "ram-func.h"
+#include "timebase.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define TIMEBASE_TIM						TIM5
+#define TIMEBASE_RCC						RCC_APB1Periph_TIM5
+#define TIMEBASE_IRQn						TIM5_IRQn
+#define TIMEBASE_TICK_HZ					1000000
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+// 32 bit cao cua dong ho, tang moi lan TIM5 tran (~71.6 phut)
+static volatile uint32_t dwTimebaseHigh = 0;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   TimebaseInit
+ * @brief  Cho TIM5 dem tu do 1 MHz tren toan dai 32 bit, ngat khi tran.
+ *         Xung TIM5 bang 2*PCLK1 khi APB1 co chia, bang PCLK1 khi khong chia
+ * @param  None
+ * @retval None
+ */
+void TimebaseInit(void)
+{
+	RCC_ClocksTypeDef RCC_Clocks;
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStruct;
+	NVIC_InitTypeDef NVIC_InitStruct;
+	uint32_t dwTimClk;
+
+	RCC_GetClocksFreq(&RCC_Clocks);
+	dwTimClk = RCC_Clocks.PCLK1_Frequency;
+	if((RCC->CFGR & RCC_CFGR_PPRE1) != 0)
+	{
+		dwTimClk *= 2;
+	}
+
+	RCC_APB1PeriphClockCmd(TIMEBASE_RCC, ENABLE);
+	TIM_TimeBaseStructInit(&TIM_TimeBaseStruct);
+	TIM_TimeBaseStruct.TIM_Prescaler = dwTimClk / TIMEBASE_TICK_HZ - 1;
+	TIM_TimeBaseStruct.TIM_Period = 0xFFFFFFFF;
+	TIM_TimeBaseStruct.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseStruct.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseInit(TIMEBASE_TIM, &TIM_TimeBaseStruct);
+	//TIM_TimeBaseInit tao su kien update de nap prescaler, bo co do
+	TIM_ClearFlag(TIMEBASE_TIM, TIM_FLAG_Update);
+	dwTimebaseHigh = 0;
+
+	TIM_ITConfig(TIMEBASE_TIM, TIM_IT_Update, ENABLE);
+	NVIC_InitStruct.NVIC_IRQChannel = TIMEBASE_IRQn;
+	NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = 0;
+	NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+	NVIC_Init(&NVIC_InitStruct);
+
+	TIM_Cmd(TIMEBASE_TIM, ENABLE);
+}
+/**
+ * @func   TimebaseGetUs
+ * @brief  Doc dong ho 64 bit. Doc lai neu ngat tran chen giua; tran da xay ra
+ *         nhung ngat chua chay (goi tu ngat uu tien cao hon hoac khi tat ngat)
+ *         thi tu cong them, nhan biet qua co UIF va CNT con nho
+ * @param  None
+ * @retval Thoi gian tu TimebaseInit, us
+ */
+uint64_t TimebaseGetUs(void)
+{
+	uint32_t dwHigh;
+	uint32_t dwLow;
+	uint32_t dwPending;
+
+	do
+	{
+		dwHigh = dwTimebaseHigh;
+		dwLow = TIMEBASE_TIM->CNT;
+		dwPending = ((TIMEBASE_TIM->SR & TIM_SR_UIF) != 0) && (dwLow < 0x80000000);
+	}while(dwHigh != dwTimebaseHigh);
+
+	return ((uint64_t)(dwHigh + dwPending) << 32) | dwLow;
+}
+/**
+ * @func   TimebaseElapsedUs
+ * @brief  Thoi gian troi qua tu qwStart; dong ho 64 bit khong bao gio tran
+ *         nen khong can xu ly vong lai nhu dwCalculatorTime
+ * @param  qwStart: Moc lay tu TimebaseGetUs
+ * @retval us
+ */
+uint64_t TimebaseElapsedUs(uint64_t qwStart)
+{
+	return TimebaseGetUs() - qwStart;
+}
+/**
+ * @func   TimebaseDeadline
+ * @brief  Tinh thoi han tuyet doi sau qwTimeoutUs tinh tu bay gio
+ * @param  qwTimeoutUs: Khoang thoi gian, us
+ * @retval Thoi han, dung voi TimebaseExpired
+ */
+uint64_t TimebaseDeadline(uint64_t qwTimeoutUs)
+{
+	return TimebaseGetUs() + qwTimeoutUs;
+}
+/**
+ * @func   TimebaseExpired
+ * @brief  Kiem tra da toi thoi han chua
+ * @param  qwDeadline: Thoi han tu TimebaseDeadline
+ * @retval 1 neu da het han
+ */
+uint8_t TimebaseExpired(uint64_t qwDeadline)
+{
+	return TimebaseGetUs() >= qwDeadline;
+}
+/**
+ * @func   TIM5_IRQHandler
+ * @brief  Tang 32 bit cao moi lan TIM5 tran. Chay tu SRAM nhu cac ngat khac
+ *         de khong bi tre khi flash dang xoa/ghi
+ * @param  None
+ * @retval None
+ */
+RAMFUNC void TIM5_IRQHandler(void)
+{
+	if((TIMEBASE_TIM->SR & TIM_SR_UIF) != 0)
+	{
+		TIMEBASE_TIM->SR = (uint16_t)~TIM_SR_UIF;
+		dwTimebaseHigh++;
+	}
+}
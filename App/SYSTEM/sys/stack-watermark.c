@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: stack-watermark.c
+ *
+ * Description: To mau vung stack du phong (_Min_Stack_Size) luc khoi dong va do
+ *              muc cao nhat da dung (high watermark), ke ca ngat vi ngat cung
+ *              chay tren MSP.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include "stm32f401re.h"
+#include "stack-watermark.h"
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+extern uint32_t _estack;				//Dinh RAM, MSP ban dau
+extern uint32_t _Min_Stack_Size;		//Ky hieu linker, gia tri nam o dia chi
+
+#define STACK_WM_TOP						((uint32_t)&_estack)
+#define STACK_WM_SIZE						((uint32_t)&_Min_Stack_Size)
+#define STACK_WM_BOTTOM						(STACK_WM_TOP - STACK_WM_SIZE)
+/******************************************************************************/
+/*                              PRIVATE DATA                                  */
+/******************************************************************************/
+// Muc cao nhat da thay; chi tang, lan quet sau dung som hon
+static uint32_t dwStackMaxUsed = 0;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            PRIVATE FUNCTIONS                               */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+/**
+ * @func   stackWatermarkPaint
+ * @brief  To mau tu day vung du phong den MSP hien tai. Goi dau tien trong
+ *         main, truoc khi bat ngat; phia duoi MSP khong co du lieu song
+ * @param  None
+ * @retval None
+ */
+void stackWatermarkPaint(void)
+{
+	volatile uint32_t *pdwWord = (volatile uint32_t *)STACK_WM_BOTTOM;
+	uint32_t dwSp = __get_MSP();
+
+	while((uint32_t)pdwWord < dwSp)
+	{
+		*pdwWord++ = STACK_WM_PATTERN;
+	}
+	dwStackMaxUsed = STACK_WM_TOP - dwSp;
+}
+/**
+ * @func   stackWatermarkUsed
+ * @brief  Quet tu day len toi tu dau tien bi ghi de. Chi quet phan chua biet
+ *         nen chi phi giam dan khi muc cao nhat da on dinh
+ * @param  None
+ * @retval So byte stack lon nhat da dung
+ */
+uint32_t stackWatermarkUsed(void)
+{
+	volatile const uint32_t *pdwWord = (volatile const uint32_t *)STACK_WM_BOTTOM;
+	uint32_t dwKnown = STACK_WM_TOP - dwStackMaxUsed;
+
+	while(((uint32_t)pdwWord < dwKnown)&&(*pdwWord == STACK_WM_PATTERN))
+	{
+		pdwWord++;
+	}
+	if((uint32_t)pdwWord < dwKnown)
+	{
+		dwStackMaxUsed = STACK_WM_TOP - (uint32_t)pdwWord;
+	}
+	return dwStackMaxUsed;
+}
+/**
+ * @func   stackWatermarkGet
+ * @brief  Lay thong tin stack cho man hinh chan doan
+ * @param  pWm: Ket qua
+ * @retval None
+ */
+void stackWatermarkGet(StackWatermark_t *pWm)
+{
+	pWm->dwSize = STACK_WM_SIZE;
+	pWm->dwUsed = stackWatermarkUsed();
+	pWm->dwCurrent = STACK_WM_TOP - __get_MSP();
+	pWm->byOverflow = (pWm->dwUsed >= STACK_WM_SIZE) ? 1 : 0;
+}
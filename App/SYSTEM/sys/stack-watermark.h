@@ -0,0 +1,60 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: stack-watermark.h
+ *
+ * Description: To mau vung stack du phong (_Min_Stack_Size) luc khoi dong va do
+ *              muc cao nhat da dung (high watermark), ke ca ngat vi ngat cung
+ *              chay tren MSP.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _STACK_WATERMARK_H_
+#define _STACK_WATERMARK_H_
+/******************************************************************************/
+/*                              INCLUDE FILES                                 */
+/******************************************************************************/
+#include <stdint.h>
+/******************************************************************************/
+/*                     EXPORTED TYPES and DEFINITIONS                         */
+/******************************************************************************/
+#define STACK_WM_PATTERN					0xC5C5C5C5UL
+
+typedef struct {
+	uint32_t	dwSize;				//Vung du phong _Min_Stack_Size (byte)
+	uint32_t	dwUsed;				//Muc cao nhat da dung tinh tu _estack
+	uint32_t	dwCurrent;			//Dang dung tai thoi diem doc
+	uint8_t		byOverflow;			//1 neu da cham day vung du phong
+}StackWatermark_t;
+/******************************************************************************/
+/*                              EXPORTED DATA                                 */
+/******************************************************************************/
+
+/******************************************************************************/
+/*                            EXPORTED FUNCTIONS                              */
+/******************************************************************************/
+void stackWatermarkPaint(void);
+
+uint32_t stackWatermarkUsed(void);
+
+void stackWatermarkGet(StackWatermark_t *pWm);
+
+#endif
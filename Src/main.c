@@ -37,38 +37,53 @@
 #include "string.h"
 #include "serial-uart.h"
 #include "timer.h"
-#include "qrcode-to-lcd.h"
+#include "timebase.h"
 #include "utilities.h"
 #include "button-v1-1.h"
+#include "button-scan.h"
 #include "menu.h"
+#include "str-builder.h"
+#include "display-list.h"
+#include "lcd-seq.h"
+#include "menu-widget.h"
+#include "config-store.h"
+#include "flash-sector.h"
+#include "record-log.h"
+#include "mac-set.h"
+#include "uart-channel.h"
+#include "stack-watermark.h"
+#include "cycle-count.h"
+#include "scratch-arena.h"
+#include "dut-session.h"
+#include "result-pane.h"
 /******************************************************************************/
 /*                     EXPORTED TYPES and DEFINITIONS                         */
 /******************************************************************************/
 //define other
 #define RX_MAX_INDEX_BYTE						256
-#define LENGTH_OF_MAC							8
-#define LENGTH_OF_VERSION						3
-#define LENGTH_OF_DEVICE_TYPE					1
-#define LENGTH_OF_PID							2
-#define CMD_ID_ZIGBEE_AND_BLE				0xFF
-#define CMD_ID_MCU_TOUCH					0xAB
+#define MENU_ROW_AUTO						4
+#define MENU_ROW_DIAG						5
+#define DIAG_REFRESH_MS						500
+#define AUTO_DETECT_WINDOW_MS				3000
+#define AUTO_SEEN_ZIGBEE					0x01
+#define AUTO_SEEN_BLE						0x02
+#define AUTO_SEEN_MCU						0x04
+#define DUT_SESSION_CNT						2
+#define DUT_CHANNEL_MAIN					0		//USART6
+#define DUT_CHANNEL_AUX						1		//USART1
+#define LOG_PREPARE_SLOTS					32		//Con chung nay o trong thi xoa san sector log
 /******************************************************************************/
 /*                              PRIVATE DATA                                  */
 /******************************************************************************/
 // enum of system
 typedef enum{
 	STATE_APP_STARTUP,
+	STATE_APP_MENU,
 	STATE_APP_IDLE,
-	STATE_APP_RESET
+	STATE_APP_RESET,
+	STATE_APP_DIAG
 }StateApp_e;
 
-// enum of LUMI_SWITCH
-typedef enum {
-	PROTOCOL_TYPE_ZIGBEE     = 0x00,
-	PROTOCOL_TYPE_BLUETOOTH	 = 0x01,
-	PROTOCOL_TYPE_ZWAVE		 = 0x02
-}ProtocolType_e;
-
 typedef enum {
 	SWITCH_DEVICE			= 0x01,
 	SOCKETS_DEVICE			= 0x02,
@@ -82,52 +97,37 @@ typedef enum {
 	HUMI_SENSOR				= 0x0A
 }DeviceType_e;
 
-typedef enum {
-	BLUETOOTH				= 0x00,
-	ZIGBEE					= 0x01,
-	MCU						= 0x02
-}InforType_e;
+_Static_assert(sizeof(ProdRecord_t) <= LOG_PAYLOAD_SIZE, "ProdRecord_t > LOG_PAYLOAD_SIZE");
+_Static_assert(DUT_SESSION_CNT <= RESULT_PANE_CNT, "1 o ket qua cho moi kenh DUT");
 
-typedef enum {
-	UN_PROVISION			= 0x00,
-	PROVISIONING			= 0x01,
-	PROVISIONED				= 0x02
-}ProvisionState_e;
-
-typedef struct {
-	uint8_t 			byCmdId;
-	uint8_t				protocolType;
-	uint8_t				deviceType;
-	uint8_t				byEndpointCnt;
-	ProvisionState_e	provisonState;
-	uint8_t				pbyMAC[8];
-	uint8_t				pbyVersion[3];
-	uint8_t				pbyInFor[20];
-}CmdData_t;
-
-typedef struct {
-    uint8_t		cmd_id;
-    uint8_t  	msg_from;
-    uint8_t  	version[3];
-    uint8_t  	type;
-    uint8_t  	endpoint_cnt;
-    uint8_t  	led_intensity;
-    uint8_t  	full_port;
-    uint8_t  	relay_type;
-    uint8_t  	cz_type[4];
-    uint8_t  	c_Xor;
-}McuInfor_t;
-
-static uint8_t g_byEnpointCntMCU = 0;
-static uint8_t g_byEnpointCntBLE = 0;
-static uint8_t g_byEnpointCntZigBee = 0;
-static char g_pstrMACZigbee[LENGTH_OF_MAC * 2+1] = {0};
-static char g_pstrMACBle[LENGTH_OF_MAC * 2+1] = {0};
-static char g_pstrMACLast[LENGTH_OF_MAC * 2+1] = {0};
-static char g_pstrVersionBluetooth[LENGTH_OF_VERSION*2+1] = {0};
-static char g_pstrVersionZigBee[LENGTH_OF_VERSION*2+1] = {0};
-static char g_pstrVersionMCU[LENGTH_OF_VERSION*2+1] = {0};
-static uint8_t g_byTypeMCU = 0;
+static DutSession_t g_pDutSession[DUT_SESSION_CNT];
+static ResultPane_t g_pResultPane[DUT_SESSION_CNT];
+static uint8_t g_byChannelSeen = 0;					//Bit n: kenh n da co DUT
+static uint8_t g_byFullPane = DUT_CHANNEL_MAIN;		//O chiem ca man hinh, DUT_SESSION_CNT neu chia doi
+
+static const char * const g_pcMenuMainOption[] = {"Dual mode","ZB mode","BLE mode","Auto detect","Diagnostics"};
+static const TestSwMode_e g_pModeOfMenuRow[] = {DUAL_MODE, ZIGBEE_MODE, BLE_MODE};
+static MenuWidget_t g_menuMain;
+
+static ConfigStore_t g_configStore;
+static StationConfig_t g_stationConfig;
+static uint8_t g_byBootFromConfig = 0;
+
+// Tu nhan dien che do: gom cac loai ban tin nhan duoc trong 1 cua so thoi gian
+static uint8_t g_byAutoDetect = 0;
+static uint8_t g_byAutoSeen = 0;
+static TestSwMode_e g_autoCandidate = NONE;
+static uint64_t g_qwAutoWindowStart = 0;
+
+// Nhat ky san xuat
+static RecordLog_t g_recordLog;
+static uint8_t g_byTitleAlert = 0;
+static uint8_t g_byLogPrepare = 1;		//Xoa san sector log o vong lap ranh ke tiep
+
+
+// Man hinh chan doan, cap nhat dinh ky
+static uint64_t g_qwDiagRefresh = 0;
+static CycleProbe_t g_cyclePaneDraw;		//So chu ky ve o ket qua (vong lap pixel)
 
 static TestSwMode_e modeTest = NONE;
 ValueKey_e valueKey = NOKEY;
@@ -147,34 +147,50 @@ static StateApp_e getStateApp(void);
 
 static void appStateManager(void);
 
-void printMACLcd(char *pTextMAC,u16 x,u16 y,uint8_t bySize);
+static uint8_t menuRowOfMode(TestSwMode_e mode);
 
-void printEndPointCnt(u8 pTextEpc,u16 x,u16 y,uint8_t bySize, InforType_e type);
+static void autoDetectStart(void);
 
-void printVersion(char *pTextMAC,u16 x,u16 y,uint8_t bySize,InforType_e type);
+static void autoDetectFeed(uint8_t bySeen);
 
-void printModelId(char *pText,u16 x,u16 y,uint8_t bySize);
+static void autoDetectProcess(void);
 
-void printProductID(char *pText,u16 x,u16 y,uint8_t bySize);
+static void dutSessionForgetLast(void);
 
-void printTypeMCU(u8 pText,u16 x,u16 y,uint8_t bySize);
+static void logDutResult(DutSession_t *pSess,DutResult_e result);
 
-void getModelID(char * pOutPut,u8 *pInPut);
+static void macSetRebuild(uint16_t wLimit);
 
-static void hexToAscii(char *pByDataOutPut,uint8_t *pByDataInPut,uint8_t byDataLength);
+static void logPrepareProcess(void);
 
-static void processedUartReceivedNewsOfZigbeeAndBLE(CmdData_t *pCmd);
+static void showTitleAlert(const char *pcAlert);
+
+static void resultScreenInit(void);
+
+static void resultScreenInvalidate(void);
+
+static void resultScreenLayout(uint8_t byFullPane);
+
+static void dutSessionEvent(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd);
 
-static void processedUartReceivedNewsOfTouch(McuInfor_t *pCmd);
 
 static void procUartCmd(void *arg);
 
+static void procUartChannelCmd(uint8_t byChannel,void *arg);
+
+static void dutChannelRxCmd(uint8_t byEnable);
+
+static void dutChannelFlush(uint8_t byChannel);
+
+static void showDiagScreen(void);
+
 
 /******************************************************************************/
 /*                            EXPORTED FUNCTIONS                              */
 /******************************************************************************/
 int main(void)
 {
+	stackWatermarkPaint();
 	appInitCommon();
 
     /* Loop forever */
@@ -182,6 +198,7 @@ int main(void)
 	{
 		appStateManager();
 		processSerialUartReceiver();
+		uartChannelProcess(&g_uartChannelAux);
 	}
 }
 /**
@@ -195,21 +212,44 @@ static void appInitCommon(void)
 {
 	SystemCoreClockUpdate();
 	buttonInit();
+	buttonScanInit();
+	cycleCountInit();
 	TimerInit();
+	TimebaseInit();
 	serialUartInit();
-	LCD_Init();
+	LCD_SeqInit();
+	resultScreenInit();
+	menuWidgetInit(&g_menuMain, "MENU", g_pcMenuMainOption, 5, 20);
+
+	g_stationConfig.byTestMode = NONE;
+	g_stationConfig.byAutoDetect = 0;
+	configStoreInit(&g_configStore, &g_flashDevConfig, &g_stationConfig);
+	recordLogInit(&g_recordLog, &g_flashDevLog);
+	macSetRebuild(MAC_SET_MAX_FILL);
+	g_byBootFromConfig = g_stationConfig.byAutoDetect || \
+						 (menuRowOfMode((TestSwMode_e)g_stationConfig.byTestMode) != 0);
 	SerialHandleEventCallback(procUartCmd);
+	for(uint8_t i = 0; i < DUT_SESSION_CNT; i++)
+	{
+		dutSessionInit(&g_pDutSession[i], i, dutSessionEvent);
+	}
+	uartChannelAuxInit(DUT_CHANNEL_AUX, procUartChannelCmd);
 	eCurrentState = STATE_APP_STARTUP;
 }
 /**
  * @func   setStateApp
- * @brief  Set state of application
+ * @brief  Set state of application. Doi trang thai thi bo phim da nhan luc
+ *         trang thai cu (splash, ve lai menu...)
  * @param  state: State of application
  * @retval None
  */
 
 static void setStateApp(StateApp_e state)
 {
+	if(state != eCurrentState)
+	{
+		buttonScanFlush();
+	}
 	eCurrentState = state;
 }
 /**
@@ -231,692 +271,529 @@ static StateApp_e getStateApp(void)
 static void appStateManager(void)
 {
 	StateApp_e event = getStateApp();
+	uint8_t byMenuRow;
+	uint8_t byKey;
 	switch(event)
 	{
 	case STATE_APP_STARTUP: //Su kien khi he thong bat dau duoc cap nguon
-		Gui_Drawbmp16(0,0,gImage_logo);
+		LCD_SeqDrawBmp16(0,0,240,320,gImage_logo);
+		resultScreenInvalidate();
 		delay_ms(2000);
-		do{
-			modeTest = getModeTest();
+		if(g_byBootFromConfig) //Vao thang che do da luu, RETURN de chon lai
+		{
+			g_byBootFromConfig = 0;
+			if(g_stationConfig.byAutoDetect)
+			{
+				menuWidgetSelect(&g_menuMain, MENU_ROW_AUTO);
+				autoDetectStart();
+			}else
+			{
+				g_byAutoDetect = 0;
+				modeTest = (TestSwMode_e)g_stationConfig.byTestMode;
+				menuWidgetSelect(&g_menuMain, menuRowOfMode(modeTest));
+			}
+			setStateApp(STATE_APP_IDLE);
+			dutChannelRxCmd(1);
+			break;
+		}
+		menuWidgetShow(&g_menuMain);
+		setStateApp(STATE_APP_MENU);
+		break;
+	case STATE_APP_MENU: //Moi vong lap chi xu ly 1 phim, khong chan vong lap chinh
+		byMenuRow = menuWidgetProcess(&g_menuMain, buttonScanProcess());
+		if(byMenuRow == MENU_ROW_AUTO)
+		{
+			autoDetectStart();
+			g_stationConfig.byAutoDetect = 1;
+			configStoreSave(&g_configStore, &g_stationConfig);
+			setStateApp(STATE_APP_IDLE);
+			dutChannelRxCmd(1);
+		}else if(byMenuRow == MENU_ROW_DIAG)
+		{
+			showDiagScreen();
+			g_qwDiagRefresh = TimebaseGetUs();
+			setStateApp(STATE_APP_DIAG);
+		}else if(byMenuRow != 0) //Chon tay de ghi de che do tu nhan dien
+		{
+			g_byAutoDetect = 0;
+			modeTest = g_pModeOfMenuRow[byMenuRow - 1];
+			g_stationConfig.byTestMode = modeTest;
+			g_stationConfig.byAutoDetect = 0;
+			configStoreSave(&g_configStore, &g_stationConfig);
+			setStateApp(STATE_APP_IDLE);
+			dutChannelRxCmd(1);
 		}
-		while(modeTest == NONE);
-
-		setStateApp(STATE_APP_IDLE);
-		USART_ITConfig(USART6, USART_IT_RXNE, ENABLE);
 		break;
 	case STATE_APP_IDLE:
-		if(processEventButton() == RETURN)
+		if(buttonScanProcess() == RETURN)
 				{
-					USART_ITConfig(USART6, USART_IT_RXNE, DISABLE);
+					dutChannelRxCmd(0);
 					setStateApp(STATE_APP_RESET);
 				}
 				processSerialUartReceiver();
+				uartChannelProcess(&g_uartChannelAux);
+				autoDetectProcess();
+				logPrepareProcess();
 		break;
 	case STATE_APP_RESET:
-		memset(g_pstrMACLast,0,sizeof(g_pstrMACLast));
+		dutSessionForgetLast();
 		setStateApp(STATE_APP_STARTUP);
 		break;
+	case STATE_APP_DIAG:
+		byKey = buttonScanProcess();
+		if(byKey == RETURN)
+		{
+			menuWidgetShow(&g_menuMain);
+			setStateApp(STATE_APP_MENU);
+		}else if(byKey == SELECT) //Doi ART va do lai tu dau
+		{
+			cycleCountSetArt(!cycleCountArtIsOn());
+			cycleProbeReset(&g_cycleUartAuxIsr);
+			cycleProbeReset(&g_cycleButtonScanIsr);
+			cycleProbeReset(&g_cyclePaneDraw);
+			showDiagScreen();
+			g_qwDiagRefresh = TimebaseGetUs();
+		}else if(TimebaseElapsedUs(g_qwDiagRefresh) >= DIAG_REFRESH_MS * TIMEBASE_US_PER_MS)
+		{
+			showDiagScreen();
+			g_qwDiagRefresh = TimebaseGetUs();
+		}
+		break;
 	default:
 		break;
 
 	}
 }
-
-
-
-static void processedUartReceivedNewsOfTouch(McuInfor_t *pCmd)
+/**
+ * @func   menuRowOfMode
+ * @brief  Tim dong menu ung voi che do test
+ * @param  mode: Che do test
+ * @retval Dong menu, tu 1; 0 neu khong phai che do hop le
+ */
+static uint8_t menuRowOfMode(TestSwMode_e mode)
 {
-
-	g_byEnpointCntMCU = pCmd->endpoint_cnt;
-
-	g_byTypeMCU = pCmd->type;
-
-	hexToAscii(g_pstrVersionMCU,pCmd->version,LENGTH_OF_VERSION);
-
+	for(uint8_t i = 0; i < sizeof(g_pModeOfMenuRow)/sizeof(g_pModeOfMenuRow[0]); i++)
+	{
+		if(g_pModeOfMenuRow[i] == mode)
+		{
+			return i + 1;
+		}
+	}
+	return 0;
 }
-
-
-static void processedUartReceivedNewsOfZigbeeAndBLE(CmdData_t *pCmd)
+/**
+ * @func   autoDetectStart
+ * @brief  Bat dau tu nhan dien che do test, chua xu ly ban tin cho den khi
+ *         nhan du 1 cua so
+ * @param  None
+ * @retval None
+ */
+static void autoDetectStart(void)
 {
-	//0.Get mode
-
-	//1. Khai bao chuoi chua thong tin in ra QR
-	char byDataPrint[5+(LENGTH_OF_MAC+LENGTH_OF_VERSION*2 +LENGTH_OF_PID \
-			+ LENGTH_OF_DEVICE_TYPE)*2] = {0};
-
-	//2. Chuoi chua thong tin hien tai
-	char pstrMAC[LENGTH_OF_MAC * 2+1] = {0};
-	char pstrDeviceType[LENGTH_OF_DEVICE_TYPE * 2 +1] = {0};
-	static char pStrPID[LENGTH_OF_PID * 2 +1] = {0};
-	static char pStrModelID[20] = {0};
-	//3. Xoa du lieu cu
-	memset(byDataPrint,0,sizeof(byDataPrint));
-	//4. Chuyen doi du lieu tu dang Hex sang ma ASCII
-
-
-	hexToAscii( pstrMAC,pCmd->pbyMAC, LENGTH_OF_MAC);
-
-	hexToAscii(pstrDeviceType, &(pCmd->deviceType), LENGTH_OF_DEVICE_TYPE);
-
-	//5. Quet 2 lan de lay version cua zigbee va bluetooth
-	static uint8_t byStatusTemp = 0;
-
-	if(pCmd->protocolType == PROTOCOL_TYPE_ZIGBEE)
+	g_byAutoDetect = 1;
+	g_byAutoSeen = 0;
+	g_autoCandidate = NONE;
+	g_qwAutoWindowStart = TimebaseGetUs();
+	modeTest = NONE;
+}
+/**
+ * @func   autoDetectFeed
+ * @brief  Ghi nhan loai ban tin vua nhan vao cua so hien tai
+ * @param  bySeen: AUTO_SEEN_xxx
+ * @retval None
+ */
+static void autoDetectFeed(uint8_t bySeen)
+{
+	if(g_byAutoDetect)
 	{
-		byStatusTemp ++;
-		hexToAscii( g_pstrVersionZigBee,pCmd->pbyVersion, LENGTH_OF_VERSION);
-
-		memset(g_pstrMACZigbee,0,sizeof(g_pstrMACZigbee));
-		strcpy(g_pstrMACZigbee,pstrMAC);
-		g_byEnpointCntZigBee = pCmd->byEndpointCnt;
-
-		getModelID(pStrModelID, pCmd->pbyInFor);
+		g_byAutoSeen |= bySeen;
+	}
+}
+/**
+ * @func   autoDetectProcess
+ * @brief  Het cua so thi suy ra che do tu cac ban tin da thay (ZigBee + BLE ->
+ *         Dual, chi 1 loai -> che do do). Chi tinh cua so co ban tin MCU, tuc
+ *         la da thay du 1 chu ky cua DUT. Lan dau thi chuyen ngay, dang o 1
+ *         che do thi can 2 cua so lien tiep cung ket qua moi doi
+ * @param  None
+ * @retval None
+ */
+static void autoDetectProcess(void)
+{
+	TestSwMode_e mode = NONE;
 
-	}else if(pCmd->protocolType == PROTOCOL_TYPE_BLUETOOTH)
+	if(!g_byAutoDetect || \
+	   TimebaseElapsedUs(g_qwAutoWindowStart) < AUTO_DETECT_WINDOW_MS * TIMEBASE_US_PER_MS)
 	{
-		byStatusTemp ++;
-		hexToAscii( g_pstrVersionBluetooth,pCmd->pbyVersion, LENGTH_OF_VERSION);
-
-		memset(g_pstrMACBle,0,sizeof(g_pstrMACBle));
-		strcpy(g_pstrMACBle,pstrMAC);
-		g_byEnpointCntBLE = pCmd->byEndpointCnt;
-
-		hexToAscii( pStrPID,pCmd->pbyInFor, LENGTH_OF_PID);
+		return;
 	}
 
-		//6.1 Reset buffer khi mac thay doi
-	static uint8_t byFlagOfBufReset = 0;
-
-	if((strcmp(&g_pstrMACZigbee[4],&g_pstrMACLast[4])!=0)||(strcmp(&g_pstrMACBle[4],&g_pstrMACLast[4])!=0))
+	if(g_byAutoSeen & AUTO_SEEN_MCU)
 	{
-		USART_ITConfig(USART6, USART_IT_RXNE, DISABLE);
-		if(byFlagOfBufReset == 0)
+		switch(g_byAutoSeen & (AUTO_SEEN_ZIGBEE | AUTO_SEEN_BLE))
 		{
-			//Reset data of queue
-			resetBuffer();
-			g_byEnpointCntMCU = 0;
-			memset(g_pstrVersionBluetooth,0,sizeof(g_pstrVersionBluetooth));
-			memset(g_pstrVersionZigBee,0,sizeof(g_pstrVersionZigBee));
-			byFlagOfBufReset = 1;
-
+		case AUTO_SEEN_ZIGBEE | AUTO_SEEN_BLE:
+			mode = DUAL_MODE;
+			break;
+		case AUTO_SEEN_ZIGBEE:
+			mode = ZIGBEE_MODE;
+			break;
+		case AUTO_SEEN_BLE:
+			mode = BLE_MODE;
+			break;
+		default:
+			break;
 		}
-		USART_ITConfig(USART6, USART_IT_RXNE, ENABLE);
 	}
-	//7. So sanh MAC , Ghep thong tin vao 1 chuoi, va in ma Qr_Code ra man hinh
-		//Gia tri dem so lan quet lai ban tin khi thay doi thiet bi co endpoint khac
-	static uint8_t byCountTemp = 0;
-
-	//7.1 Dual mode
-
-	switch(modeTest)
-			{
-			case DUAL_MODE:
-				if(strcmp(&g_pstrMACZigbee[4],&g_pstrMACLast[4])!=0 &&(byStatusTemp>=2))
-				{
-					// In ra gia tri khi quet du thong tin
-					strcpy(g_pstrMACLast,pstrMAC);
-
-
-					if((g_byEnpointCntMCU == g_byEnpointCntBLE)&&(g_byEnpointCntMCU == g_byEnpointCntZigBee))
-					{
-					//Ghep thong tin can luu tru trong QR-code
-						strcat(byDataPrint,g_pstrMACZigbee);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,pstrDeviceType);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,pStrPID);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,g_pstrVersionZigBee);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,g_pstrVersionBluetooth);
-
-					//prinf Qr-code
-						generateQRCode(0,25,byDataPrint,strlen(byDataPrint));
-
-					//prinf Information
-
-						LCD_ClearCursor(0, 155, 240, 320, WHITE);
-
-						printMACLcd(g_pstrMACZigbee,10,155,16);
-						//Information General
-						printEndPointCnt(g_byEnpointCntMCU, 10, 175, 16,MCU);
-
-						LCD_DrawLine(10,190,230,190);
-
-						//Information of Zigbee chip
-						printVersion(g_pstrVersionZigBee, 10, 195, 16,ZIGBEE);
-
-						printModelId(pStrModelID, 10 ,215 ,16);
-
-						LCD_DrawLine(10,235,230,235);
-
-						//Information of BLE chip
-						printVersion(g_pstrVersionBluetooth, 10, 235, 16,BLUETOOTH);
-
-						printProductID(pStrPID, 10 ,255 ,16);
-
-						LCD_DrawLine(10,275,230,275);
-
-						//Information of MCU
-						printVersion(g_pstrVersionMCU, 10, 275, 16, MCU);
-
-						printTypeMCU(g_byTypeMCU, 10, 295, 16);
-
-						//Reset varialble
-						byFlagOfBufReset = 0;
-
-						byCountTemp = 0;
-
-						g_byEnpointCntMCU = 0;
-
-						g_byEnpointCntBLE = 0;
-
-						g_byEnpointCntZigBee = 0;
-
-					}else
-					{
-						//7. Neu gia tri endPointCnt khac thi cho quet lai lan nua
-							if(byCountTemp == 0)
-							{
-								memset(g_pstrMACLast,0,sizeof(g_pstrMACLast));
-								byStatusTemp =0;
-								byCountTemp ++;
-							}else if(byCountTemp>=1)
-							{
-								//7.1 Neu firmware loi
-								if((g_byEnpointCntMCU != g_byEnpointCntBLE))
-								{
-									LCD_ClearCursor(0, 25, 240, 320, WHITE);
-									//In ra MAC loi.
-									Gui_StrCenter(0,100,RED, WHITE, (u8 *)"Firmware BLE ERROR!!!", 16, 0);
-
-									printMACLcd(g_pstrMACZigbee,10,120,16);
-
-									printEndPointCnt(g_byEnpointCntZigBee, 10, 140, 16,ZIGBEE);
-
-									printEndPointCnt(g_byEnpointCntBLE, 10, 160, 16,BLUETOOTH);
-
-
-									memset(g_pstrVersionBluetooth,0,sizeof(g_pstrVersionBluetooth));
-									memset(g_pstrVersionZigBee,0,sizeof(g_pstrVersionZigBee));
-									memset(pStrPID,0,sizeof(pStrPID));
-									memset(pstrDeviceType,0,sizeof(pstrDeviceType));
-									byCountTemp = 0;
-								}
-								if(g_byEnpointCntMCU != g_byEnpointCntZigBee)
-								{
-									LCD_ClearCursor(0, 25, 240, 320, WHITE);
-
-									Gui_StrCenter(0,100,RED, WHITE, (u8 *)"Firmware ZigBee ERROR!!!", 16, 0);
-
-									//In ra MAC loi.
-
-									printMACLcd(g_pstrMACZigbee,10,120,16);
-									//In ra endpointCnt
-									printEndPointCnt(g_byEnpointCntZigBee, 10, 140, 16,ZIGBEE);
-
-									printEndPointCnt(g_byEnpointCntBLE, 10, 160, 16,BLUETOOTH);
-
-									//Reset mang chua ca thong tin: Version, Product ID, Device Type
-									memset(g_pstrVersionBluetooth,0,sizeof(g_pstrVersionBluetooth));
-									memset(g_pstrVersionZigBee,0,sizeof(g_pstrVersionZigBee));
-									memset(pStrPID,0,sizeof(pStrPID));
-									memset(pstrDeviceType,0,sizeof(pstrDeviceType));
-									byCountTemp = 0;
-								}
-							}
-					}
-				}
-				break;
-			case ZIGBEE_MODE:
-				if(strcmp(&g_pstrMACZigbee[4],&g_pstrMACLast[4])!=0 &&(byStatusTemp>=2))
-				{
-					// In ra gia tri khi quet du thong tin
-					strcpy(g_pstrMACLast,pstrMAC);
-
-
-					if(g_byEnpointCntMCU == g_byEnpointCntZigBee)
-					{
-
-						strcat(byDataPrint,g_pstrMACZigbee);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,pstrDeviceType);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,g_pstrVersionZigBee);
-
-						generateQRCode(0,25,byDataPrint,strlen(byDataPrint));
-
-						//prinf Information
-
-						LCD_ClearCursor(0, 155, 240, 320, WHITE);
-
-						printMACLcd(g_pstrMACZigbee,10,155,16);
-						//Information General
-						printEndPointCnt(g_byEnpointCntMCU, 10, 175, 16,MCU);
-
-						LCD_DrawLine(10,195,230,195);
-
-						//Information of Zigbee chip
-						printVersion(g_pstrVersionZigBee, 10, 195, 16,ZIGBEE);
-
-						printModelId(pStrModelID, 10 ,215 ,16);
-
-						LCD_DrawLine(10,235,230,235);
-
-						//Information of MCU
-						printVersion(g_pstrVersionMCU, 10, 235, 16, MCU);
-
-						printTypeMCU(g_byTypeMCU, 10, 255, 16);
-
-						//Reset varialble
-						byFlagOfBufReset = 0;
-
-						byCountTemp = 0;
-
-						g_byEnpointCntMCU = 0;
-
-						g_byEnpointCntBLE = 0;
-
-						g_byEnpointCntZigBee = 0;
-
-					}else
-					{
-						//7. Neu gia tri endPointCnt khac thi cho quet lai lan nua
-
-							if(byCountTemp == 0)
-							{
-								memset(g_pstrMACLast,0,sizeof(g_pstrMACLast));
-								byStatusTemp =0;
-								byCountTemp ++;
-							}else if(byCountTemp>=1)
-							{
-								LCD_ClearCursor(0, 25, 240, 320, WHITE);
-								Gui_StrCenter(0,100,RED, WHITE, (u8 *)"Firmware ERROR!!!", 16, 0);
-								printMACLcd(g_pstrMACZigbee,10,120,16);
-								memset(g_pstrVersionBluetooth,0,sizeof(g_pstrVersionBluetooth));
-								memset(g_pstrVersionZigBee,0,sizeof(g_pstrVersionZigBee));
-								memset(pStrPID,0,sizeof(pStrPID));
-								memset(pstrDeviceType,0,sizeof(pstrDeviceType));
-								byCountTemp = 0;
-							}
-					}
-				}
-				break;
-			case BLE_MODE:
-				if(strcmp(&g_pstrMACBle[4],&g_pstrMACLast[4])!=0 &&(byStatusTemp>=2))
-				{
-					// In ra gia tri khi quet du thong tin
-					strcpy(g_pstrMACLast,pstrMAC);
-
-
-					if(g_byEnpointCntMCU == g_byEnpointCntBLE)
-					{
-
-
-						//Ghep thong tin can luu tru trong QR-code
-						strcat(byDataPrint,g_pstrMACBle);
-
-						strcat(byDataPrint,",");
 
-						strcat(byDataPrint,pstrDeviceType);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,pStrPID);
-
-						strcat(byDataPrint,",");
-
-						strcat(byDataPrint,g_pstrVersionBluetooth);
-
-					//prinf Qr-code
-						generateQRCode(0,25,byDataPrint,strlen(byDataPrint));
-
-					//prinf Information
-
-						LCD_ClearCursor(0, 155, 240, 320, WHITE);
-
-						printMACLcd(g_pstrMACBle,10,155,16);
-						//Information General
-						printEndPointCnt(g_byEnpointCntMCU, 10, 175, 16,MCU);
-
-						LCD_DrawLine(10,195,230,195);
-
-						//Information of BLE chip
-						printVersion(g_pstrVersionBluetooth, 10, 195, 16,BLUETOOTH);
-
-						printProductID(pStrPID, 10 ,215 ,16);
-
-						LCD_DrawLine(10,235,230,235);
-
-						//Information of MCU
-						printVersion(g_pstrVersionMCU, 10, 235, 16, MCU);
-
-						printTypeMCU(g_byTypeMCU, 10, 255, 16);
-
-						//Reset varialble
-						byFlagOfBufReset = 0;
-
-						byCountTemp = 0;
-
-						g_byEnpointCntMCU = 0;
-
-						g_byEnpointCntBLE = 0;
-
-						g_byEnpointCntZigBee = 0;
-
-					}else
-					{
-						//7. Neu gia tri endPointCnt khac thi cho quet lai lan nua
-
-							if(byCountTemp == 0)
-							{
-								memset(g_pstrMACLast,0,sizeof(g_pstrMACLast));
-								byStatusTemp =0;
-								byCountTemp ++;
-							}else if(byCountTemp>=1)
-							{
-								LCD_ClearCursor(0, 25, 240, 320, WHITE);
-								Gui_StrCenter(0,100,RED, WHITE, (u8 *)"Firmware ZigBee ERROR!!!", 16, 0);
-								printMACLcd(g_pstrMACZigbee,10,120,16);
-								printEndPointCnt(g_byEnpointCntBLE, 10, 160, 16,BLUETOOTH);
-								memset(g_pstrVersionBluetooth,0,sizeof(g_pstrVersionBluetooth));
-								memset(g_pstrVersionZigBee,0,sizeof(g_pstrVersionZigBee));
-								memset(pStrPID,0,sizeof(pStrPID));
-								memset(pstrDeviceType,0,sizeof(pstrDeviceType));
-								byCountTemp = 0;
-							}
-					}
-				}
-				break;
-			default:
-				break;
-			}
-
-	if(byStatusTemp >=2)
+	if(mode != NONE && mode != modeTest && (modeTest == NONE || mode == g_autoCandidate))
 	{
-		byStatusTemp =0;
+		modeTest = mode;
+		menuWidgetSelect(&g_menuMain, menuRowOfMode(mode));
+		resultScreenInvalidate();
+		dutSessionForgetLast();
 	}
+	g_autoCandidate = mode;
+	g_byAutoSeen = 0;
+	g_qwAutoWindowStart = TimebaseGetUs();
 }
 /**
- * @func   procUartCmd
- * @brief  Xu ly truong CMD_ID cua thiet bi
- * @param  void *arg
+ * @func   dutSessionForgetLast
+ * @brief  Quen MAC vua test tren moi kenh de DUT tiep theo (ke ca DUT cu) duoc
+ *         test lai
+ * @param  None
  * @retval None
  */
-static void procUartCmd(void *arg)
+static void dutSessionForgetLast(void)
 {
-
-	CmdData_t *CmdData = (CmdData_t*)arg;
-	McuInfor_t * McuInfor = (McuInfor_t*)arg;
-	switch(CmdData->byCmdId)
+	for(uint8_t i = 0; i < DUT_SESSION_CNT; i++)
 	{
-	case CMD_ID_ZIGBEE_AND_BLE:
-		processedUartReceivedNewsOfZigbeeAndBLE(CmdData);
-		break;
-	case CMD_ID_MCU_TOUCH:
-		processedUartReceivedNewsOfTouch(McuInfor);
-		break;
-	default:
-		break;
+		g_pDutSession[i].qwMACLast = 0;
 	}
-
+	scratchArenaReset();
 }
-static void hexToAscii(char *pByDataOutPut,uint8_t *pByDataInPut,uint8_t byDataLength)
+/**
+ * @func   logDutResult
+ * @brief  Ghi ket qua DUT cua 1 kenh vao nhat ky flash: 12 lan ghi word, them
+ *         header khi doi sector (sector moi da duoc logPrepareProcess xoa san).
+ *         Tap MAC day thi nap lai tu nhat ky, doc toi MAC_SET_MAX_FILL ban ghi.
+ *         Ghi loi thi bao tren thanh tieu de
+ * @param  pSess: Phien test cua kenh
+ * @param  result: Ket qua test
+ * @retval None
+ */
+static void logDutResult(DutSession_t *pSess,DutResult_e result)
 {
-	uint8_t byMsb,byLsb;
-	memset(pByDataOutPut,0,byDataLength);
-	static char str[2]={0};
-	for(uint8_t i = 0; i<byDataLength; i++)
+	uint8_t pbyPayload[LOG_PAYLOAD_SIZE] = {0};
+	//MAC ZigBee/BLE cua cung 1 DUT chi giong nhau o 6 byte thap
+	uint64_t qwMAC = MAC_LOW48(macFromBytes(pSess->prodRecord.pbyMAC));
+
+	//Chi DUT dat moi vao tap MAC; MAC da co thi bao trung ngay tren man hinh
+	if(result == DUT_RESULT_PASS)
 	{
-		byMsb = (pByDataInPut[i]>>4);
-		byLsb = pByDataInPut[i] & 0x0F;
-		if((byMsb>=0)&&(byMsb<=9))
-		{
-			byMsb += 48;
-		}else
+		if(macSetContains(qwMAC))
 		{
-			byMsb += 55;
-		}
-		if((byLsb>=0)&&(byLsb<=9))
+			result = DUT_RESULT_DUPLICATE;
+		}else if(macSetInsert(qwMAC) == MAC_SET_FULL)
 		{
-			byLsb += 48;
-		}else
-		{
-			byLsb += 55;
+			macSetRebuild(MAC_SET_MAX_FILL / 2);
+			macSetInsert(qwMAC);
 		}
-		str[0] = (char)byMsb;
-		str[1] = (char)byLsb;
-		strcat(pByDataOutPut,str);
 	}
+
+	pSess->prodRecord.byMode = modeTest;
+	pSess->prodRecord.byResult = result;
+	memcpy(pbyPayload, &pSess->prodRecord, sizeof(pSess->prodRecord));
+	if(recordLogAppend(&g_recordLog, pbyPayload) != 0)
+	{
+		showTitleAlert("LOG WRITE ERROR!!!");
+	}else if((result == DUT_RESULT_PASS)||(result == DUT_RESULT_DUPLICATE))
+	{
+		showTitleAlert((result == DUT_RESULT_DUPLICATE) ? "DUPLICATE MAC!!!" : NULL);
+	}
+	g_byLogPrepare = 1;
 }
 /**
- * @func   printMACLcd
- * @brief  In ra man hinh MAC cua thiet bi theo form XX:XX:XX:XX
- * @param
+ * @func   macSetRebuild
+ * @brief  Nap lai tap MAC tu cac ban ghi dat moi nhat trong nhat ky
+ * @param  wLimit: So MAC toi da nap vao
  * @retval None
  */
-void printMACLcd(char *pTextMAC,u16 x,u16 y,uint8_t bySize)
+static void macSetRebuild(uint16_t wLimit)
 {
+	ProdRecord_t record;
+	uint8_t pbyPayload[LOG_PAYLOAD_SIZE];
 
-	char strTemp[28];
-
-	char strTemp2[] = ":";
-
-	char strTemp3[] = "MAC ";
-
-	//Show_Str(x+20,y,BLACK,WHITE,(u8*)strTemp3,bySize,1);
-
-	memset(strTemp,0,sizeof(strTemp));
-
-	strcpy(strTemp,strTemp3);
-
-	uint8_t j = 4;
-	uint8_t i = 0;
-	for(i = 0; i<strlen(pTextMAC); i++)
+	macSetClear();
+	for(uint32_t i = recordLogCount(&g_recordLog); i > 0 && macSetCount() < wLimit; i--)
 	{
-			if((i%2 == 0)&&(i !=0))
+		if(recordLogRead(&g_recordLog, i - 1, pbyPayload))
+		{
+			memcpy(&record, pbyPayload, sizeof(record));
+			if(record.byResult == DUT_RESULT_PASS)
 			{
-				j++;
-				strcat(strTemp,strTemp2);
+				macSetInsert(MAC_LOW48(macFromBytes(record.pbyMAC)));
 			}
-			strTemp[j] = pTextMAC[i];
-			j++;
+		}
 	}
-	Show_Str(x,y,BLACK,WHITE,(u8*)strTemp,bySize,1);
 }
 /**
- * @func   printEndPointCnt
- * @brief  In ra man hinh EndPointCnt cua thiet bi theo form
- * @param
+ * @func   logPrepareProcess
+ * @brief  Sau moi lan ghi ket qua, xoa san sector log ke tiep neu sector dang
+ *         ghi sap day. Chay o vong lap sau, khi ket qua da hien thi xong, nen
+ *         lan xoa 128K (1-2 s) khong lam cham quyet dinh DAT/LOI; DUT vua test
+ *         van gui ban tin trong luc xoa, mat cung khong sao
+ * @param  None
  * @retval None
  */
-void printEndPointCnt(u8 pTextEpc,u16 x,u16 y,uint8_t bySize, InforType_e type)
+static void logPrepareProcess(void)
 {
+	if(!g_byLogPrepare)
+	{
+		return;
+	}
+	g_byLogPrepare = 0;
+	if(recordLogPrepare(&g_recordLog, LOG_PREPARE_SLOTS) != 0)
+	{
+		showTitleAlert("LOG ERASE ERROR!!!");
+	}
+}
+/**
+ * @func   showTitleAlert
+ * @brief  Bao loi (MAC trung, ghi nhat ky loi) tren thanh tieu de; NULL thi
+ *         tra lai tieu de che do test neu dang bao loi
+ * @param  pcAlert: Thong bao, NULL de xoa
+ * @retval None
+ */
+static void showTitleAlert(const char *pcAlert)
+{
+	if(pcAlert != NULL)
+	{
+		LCD_SeqFill(0, 0, lcddev.width - 1, 20, RED);
+		Gui_StrCenter(0, 2, WHITE, RED, (u8 *)pcAlert, 16, 0);
+		g_byTitleAlert = 1;
+	}else if(g_byTitleAlert)
+	{
+		menuWidgetShowTitle(&g_menuMain);
+		g_byTitleAlert = 0;
+	}
+}
+/**
+ * @func   dutSessionEvent
+ * @brief  Xu ly quyet dinh cua phien test: DUT moi thi bo byte cu cua kenh,
+ *         DAT/LOI thi ve vao o ket qua cua kenh va ghi nhat ky
+ * @param  pSess: Phien test cua kenh
+ * @param  event: Su kien DUT_EVENT_xxx
+ * @param  pCmd: Ban tin ZigBee/BLE vua nhan
+ * @retval None
+ */
+static void dutSessionEvent(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd)
+{
+	uint32_t dwStart;
 
-	char strTemp1[20];
-	char strTemp2[3] = {0};
-	char strTemp3[] = "Button     :";
-	char strTemp4[] = "Button Zgb :";
-	char strTemp5[] = "Button BLE :";
-	hexToAscii(strTemp2, &pTextEpc, 1);
-
-	memset(strTemp1,0,sizeof(strTemp1));
-	switch(type)
+	switch(event)
 	{
-	case BLUETOOTH:
-		strcpy(strTemp1,strTemp5);
+	case DUT_EVENT_NEW_DUT:
+		dutChannelFlush(pSess->byChannel);
+		scratchArenaReset(); //DUT moi: khong con pham vi nao dang mo
+		if(!(g_byChannelSeen & (1 << pSess->byChannel)))
+		{
+			//Chi 1 kenh co DUT: o cua kenh do chiem ca man hinh
+			g_byChannelSeen |= 1 << pSess->byChannel;
+			resultScreenLayout((g_byChannelSeen == (1 << pSess->byChannel)) ? pSess->byChannel : DUT_SESSION_CNT);
+		}
 		break;
-	case ZIGBEE:
-		strcpy(strTemp1,strTemp4);
+	case DUT_EVENT_PASS:
+		dwStart = CYCLE_NOW();
+		resultPaneShowPass(&g_pResultPane[pSess->byChannel], pSess, modeTest, pCmd->deviceType);
+		CYCLE_PROBE_STOP(g_cyclePaneDraw, dwStart);
+		logDutResult(pSess, DUT_RESULT_PASS);
 		break;
-	case MCU:
-		strcpy(strTemp1,strTemp3);
+	case DUT_EVENT_FAIL_BLE:
+	case DUT_EVENT_FAIL_ZIGBEE:
+	case DUT_EVENT_FAIL_BOTH:
+		dwStart = CYCLE_NOW();
+		resultPaneShowFail(&g_pResultPane[pSess->byChannel], pSess, modeTest, event);
+		CYCLE_PROBE_STOP(g_cyclePaneDraw, dwStart);
+		logDutResult(pSess, (event == DUT_EVENT_FAIL_BLE) ? DUT_RESULT_FAIL_BLE :
+							(event == DUT_EVENT_FAIL_ZIGBEE) ? DUT_RESULT_FAIL_ZIGBEE : DUT_RESULT_FAIL_BOTH);
 		break;
 	default:
 		break;
 	}
-
-
-	uint8_t j = 12;
-	uint8_t i = 0;
-	for(i = 0; i<strlen(strTemp2); i++)
-	{
-			strTemp1[j] = strTemp2[i];
-			j++;
-	}
-	Show_Str(x,y,BLACK,WHITE,(u8*)strTemp1,bySize,1);
 }
 /**
- * @func   printVersion
- * @brief  In ra man hinh Version cua thiet bi theo form
- * @param
+ * @func   procUartCmd
+ * @brief  Xu ly truong CMD_ID cua thiet bi
+ * @param  void *arg
  * @retval None
  */
-void printVersion(char *pTextMAC,u16 x,u16 y,uint8_t bySize,InforType_e type)
+static void procUartCmd(void *arg)
 {
-
-	char strTemp1[26];
-
-	char strTemp2[] = ".";
-
-	char strTemp3[] = "Ver ZigBee :";
-
-	char strTemp4[] = "Ver BLE    :";
-
-	char strTemp5[] = "Ver MCU    :";
-
-	//Show_Str(x+20,y,BLACK,WHITE,(u8*)strTemp3,bySize,1);
-
-	memset(strTemp1,0,sizeof(strTemp1));
-
-	switch(type)
+	procUartChannelCmd(DUT_CHANNEL_MAIN, arg);
+}
+/**
+ * @func   procUartChannelCmd
+ * @brief  Xu ly truong CMD_ID cua DUT tren 1 kenh; chi kenh chinh (USART6)
+ *         co lop hoi/dap
+ * @param  byChannel: Kenh nhan ban tin
+ * @param  void *arg
+ * @retval None
+ */
+static void procUartChannelCmd(uint8_t byChannel,void *arg)
+{
+	DutSession_t *pSess = &g_pDutSession[byChannel];
+	CmdData_t *CmdData = (CmdData_t*)arg;
+	McuInfor_t * McuInfor = (McuInfor_t*)arg;
+	switch(CmdData->byCmdId)
 	{
-	case BLUETOOTH:
-		strcpy(strTemp1,strTemp4);
-		break;
-	case ZIGBEE:
-		strcpy(strTemp1,strTemp3);
+	case CMD_ID_ZIGBEE_AND_BLE:
+		if(CmdData->protocolType == PROTOCOL_TYPE_ZIGBEE)
+		{
+			autoDetectFeed(AUTO_SEEN_ZIGBEE);
+		}else if(CmdData->protocolType == PROTOCOL_TYPE_BLUETOOTH)
+		{
+			autoDetectFeed(AUTO_SEEN_BLE);
+		}
+		dutSessionOnRadio(pSess, CmdData, modeTest);
 		break;
-	case MCU:
-		strcpy(strTemp1,strTemp5);
+	case CMD_ID_MCU_TOUCH:
+		autoDetectFeed(AUTO_SEEN_MCU);
+		dutSessionOnMcu(pSess, McuInfor);
 		break;
 	default:
 		break;
 	}
 
-
-	uint8_t j = 12;
-	uint8_t i = 0;
-	for(i = 0; i<strlen(pTextMAC); i++)
+}
+/**
+ * @func   dutChannelRxCmd
+ * @brief  Bat/tat ngat RX cua ca 2 cong DUT
+ * @param  byEnable: 1 de bat
+ * @retval None
+ */
+static void dutChannelRxCmd(uint8_t byEnable)
+{
+	USART_ITConfig(USART6, USART_IT_RXNE, byEnable ? ENABLE : DISABLE);
+	uartChannelAuxRxCmd(byEnable);
+}
+/**
+ * @func   dutChannelFlush
+ * @brief  Bo cac byte cu dang cho trong bo dem nhan cua 1 kenh
+ * @param  byChannel: Kenh
+ * @retval None
+ */
+static void dutChannelFlush(uint8_t byChannel)
+{
+	if(byChannel == DUT_CHANNEL_MAIN)
 	{
-		if((i%2 == 0)&&(i !=0))
-		{
-			j++;
-			strcat(strTemp1,strTemp2);
-		}
-			strTemp1[j] = pTextMAC[i];
-			j++;
+		USART_ITConfig(USART6, USART_IT_RXNE, DISABLE);
+		resetBuffer();
+		USART_ITConfig(USART6, USART_IT_RXNE, ENABLE);
+	}else
+	{
+		uartChannelReset(&g_uartChannelAux);
 	}
-	Show_Str(x,y,BLACK,WHITE,(u8*)strTemp1,bySize,1);
 }
 /**
- * @func   printModelId
- * @brief  In ra man hinh ModelId cua thiet bi theo form
- * @param
+ * @func   resultScreenInit
+ * @brief  Khoi tao o ket qua cua tung kenh DUT
+ * @param  None
  * @retval None
  */
-void printModelId(char *pText,u16 x,u16 y,uint8_t bySize)
+static void resultScreenInit(void)
 {
-
-	char strTemp1[30];
-
-	char strTemp2[] = "Model ID   :";
-
-	memset(strTemp1,0,sizeof(strTemp1));
-
-	strcpy(strTemp1,strTemp2);
-
-	uint8_t j = 12;
-	uint8_t i = 0;
-	for(i = 0; i<strlen(pText); i++)
+	for(uint8_t i = 0; i < DUT_SESSION_CNT; i++)
 	{
-			strTemp1[j] = pText[i];
-			j++;
+		resultPaneInit(&g_pResultPane[i], i);
 	}
-	Show_Str(x,y,BLACK,WHITE,(u8*)strTemp1,bySize,1);
+	resultPaneSetArea(&g_pResultPane[g_byFullPane], RESULT_PANE_Y0, RESULT_PANE_FULL_HEIGHT);
 }
 /**
- * @func   printProductID
- * @brief  In ra man hinh ProductID cua thiet bi theo form
- * @param
+ * @func   resultScreenInvalidate
+ * @brief  Danh dau cac o ket qua da bi ve de len (logo, menu)
+ * @param  None
  * @retval None
  */
-void printProductID(char *pText,u16 x,u16 y,uint8_t bySize)
+static void resultScreenInvalidate(void)
 {
-
-	char strTemp1[30];
-
-	char strTemp2[] = "Product ID :";
-
-	memset(strTemp1,0,sizeof(strTemp1));
-
-	strcpy(strTemp1,strTemp2);
-
-	uint8_t j = 12;
-	uint8_t i = 0;
-	for(i = 0; i<strlen(pText); i++)
+	for(uint8_t i = 0; i < DUT_SESSION_CNT; i++)
 	{
-			strTemp1[j] = pText[i];
-			j++;
+		resultPaneInvalidate(&g_pResultPane[i]);
 	}
-	Show_Str(x,y,BLACK,WHITE,(u8*)strTemp1,bySize,1);
 }
 /**
- * @func   printTypeMCU
- * @brief  In ra man hinh TypeMCU cua thiet bi theo form
- * @param
+ * @func   resultScreenLayout
+ * @brief  Doi bo cuc vung ket qua: 1 o ca man hinh (ma QR to hon) hoac moi
+ *         kenh nua man hinh. Doi thi xoa trang vung ket qua; ket qua cu mat,
+ *         moi o ve lai o lan quyet dinh ke tiep cua kenh do
+ * @param  byFullPane: O chiem ca man hinh, DUT_SESSION_CNT de chia doi
  * @retval None
  */
-void printTypeMCU(u8 pText,u16 x,u16 y,uint8_t bySize)
+static void resultScreenLayout(uint8_t byFullPane)
 {
-
-	char strTemp1[30];
-	char strTemp2[] = "Type MCU   :";
-	char strTemp3[3];
-	hexToAscii(strTemp3, &pText, 1);
-
-	memset(strTemp1,0,sizeof(strTemp1));
-
-	strcpy(strTemp1,strTemp2);
-
-	uint8_t j = 12;
-	uint8_t i = 0;
-	for(i = 0; i<strlen(strTemp3); i++)
+	if(byFullPane == g_byFullPane)
 	{
-			strTemp1[j] = strTemp3[i];
-			j++;
+		return;
 	}
-
-	Show_Str(x,y,BLACK,WHITE,(u8*)strTemp1,bySize,1);
+	for(uint8_t i = 0; i < DUT_SESSION_CNT; i++)
+	{
+		if(i == byFullPane)
+		{
+			resultPaneSetArea(&g_pResultPane[i], RESULT_PANE_Y0, RESULT_PANE_FULL_HEIGHT);
+		}else
+		{
+			resultPaneSetArea(&g_pResultPane[i], RESULT_PANE_Y0 + i * RESULT_PANE_HEIGHT, RESULT_PANE_HEIGHT);
+		}
+	}
+	LCD_SeqFill(0, RESULT_PANE_Y0, lcddev.width - 1, RESULT_PANE_Y0 + RESULT_PANE_FULL_HEIGHT - 1, WHITE);
+	g_byFullPane = byFullPane;
 }
-void getModelID(char * pOutPut,u8 *pInPut)
+/**
+ * @func   showDiagScreen
+ * @brief  Hien muc stack cao nhat / dang dung / du phong, muc cao nhat cua
+ *         vung nho tam va so chu ky lon nhat cua 2 ngat va lan ve o ket qua
+ *         khi ART dang bat/tat (SELECT de doi). Ve de len nen nen
+ *         goi lai dinh ky khong can xoa man hinh
+ * @param  None
+ * @retval None
+ */
+static void showDiagScreen(void)
 {
-	memset(pOutPut,0,20);
-	u8 j = 1;
-	for(u8 i = 0;i < pInPut[0];i++,j++)
+	static const char * const pcLabel[] = {"Stack max: ","Stack now: ","Reserved:  ","Scratch:   "};
+	static const char * const pcCycleLabel[] = {"U1 ISR:    ","TIM3 ISR:  ","Pane draw: "};
+	StackWatermark_t wm;
+	StrBuilder_t sbTemp;
+	char strLine[32];
+	uint32_t pdwValue[4];
+
+	stackWatermarkGet(&wm);
+	pdwValue[0] = wm.dwUsed;
+	pdwValue[1] = wm.dwCurrent;
+	pdwValue[2] = wm.dwSize;
+	pdwValue[3] = scratchArenaStats()->wHighWater;
+	for(uint8_t i = 0; i < 4; i++)
+	{
+		sbInit(&sbTemp, strLine, sizeof(strLine));
+		sbAppendStr(&sbTemp, pcLabel[i]);
+		sbAppendDec(&sbTemp, pdwValue[i]);
+		sbAppendStr(&sbTemp, " B   ");
+		Show_Str(10, 40 + i*24, BLACK, WHITE, (u8*)strLine, 16, 0);
+	}
+	Show_Str(10, 40 + 4*24, WHITE, wm.byOverflow ? RED : GREEN, \
+			(u8*)(wm.byOverflow ? "Stack: OVERFLOW" : "Stack: OK      "), 16, 0);
+
+	pdwValue[0] = g_cycleUartAuxIsr.dwMax;
+	pdwValue[1] = g_cycleButtonScanIsr.dwMax;
+	pdwValue[2] = g_cyclePaneDraw.dwMax;
+	for(uint8_t i = 0; i < 3; i++)
 	{
-		pOutPut[i] = pInPut[j];
+		sbInit(&sbTemp, strLine, sizeof(strLine));
+		sbAppendStr(&sbTemp, pcCycleLabel[i]);
+		sbAppendDec(&sbTemp, pdwValue[i]);
+		sbAppendStr(&sbTemp, " cyc   ");
+		Show_Str(10, 40 + (5 + i)*24, BLACK, WHITE, (u8*)strLine, 16, 0);
 	}
+	Show_Str(10, 40 + 8*24, BLACK, WHITE, \
+			(u8*)(cycleCountArtIsOn() ? "ART: ON  (SELECT)" : "ART: OFF (SELECT)"), 16, 0);
 }
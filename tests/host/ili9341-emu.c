@@ -0,0 +1,352 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: ili9341-emu.c
+ *
+ * Description: ILI9341 gia lap cho tests/host (xem ili9341-emu.h). Thay cho
+ *                            lcd.c: lcddev, LCD_direction, LCD_RESET va chan CS/RS/LED.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "stm32f401re_spi.h"
+#include "stm32f401re_dma.h"
+#include "lcd-seq.h"
+#include "ili9341-emu.h"
+
+#define EMU_DR_EMPTY			0xFFFF	//DR chi nhan 8 bit: 0xFFFF = da day ra
+#define EMU_PARAM_MAX			16
+
+// Thay cho lcd.c
+_lcd_dev lcddev;
+u16 POINT_COLOR = RED;
+u16 BACK_COLOR = WHITE;
+u8 g_byHostLcdLed;
+int g_iHostPowerOnReset = 1;
+DMA_Stream_TypeDef g_hostDma2Stream3;
+
+Ili9341EmuStats_t g_ili9341EmuStats;
+uint32_t g_pdwIli9341CmdCnt[256];
+uint8_t g_byIli9341Madctl;
+
+static u16 pwGram[ILI9341_EMU_H][ILI9341_EMU_W];
+static SPI_TypeDef spi1 = { SPI_I2S_FLAG_TXE, EMU_DR_EMPTY };
+static uint8_t byDmaPending;
+static uint8_t byCs = 1;
+static uint8_t byRs = 1;
+static uint8_t byCmd;
+static uint8_t byParamCnt;
+static uint8_t pbyParam[EMU_PARAM_MAX];
+static uint8_t byPixelHalf;
+static uint8_t byPixelHigh;
+static u16 pwWin[4];					//Cot dau/cuoi, hang dau/cuoi (logic)
+static u16 wCol;
+static u16 wPage;
+
+static void emuError(const char *pcWhat)
+{
+	if(g_ili9341EmuStats.dwErrors++ == 0)
+		g_ili9341EmuStats.pcFirstError = pcWhat;
+}
+
+static u16 emuColMax(void)
+{
+	return (g_byIli9341Madctl & ILI9341_MADCTL_MV) ? ILI9341_EMU_H - 1 : ILI9341_EMU_W - 1;
+}
+
+static u16 emuPageMax(void)
+{
+	return (g_byIli9341Madctl & ILI9341_MADCTL_MV) ? ILI9341_EMU_W - 1 : ILI9341_EMU_H - 1;
+}
+
+// Dia chi logic (cot, hang) -> o GRAM vat ly: lat MX/MY theo dia chi logic
+// roi doi cot/hang neu MV
+static u16 *emuCell(u16 wC,u16 wP)
+{
+	if(g_byIli9341Madctl & ILI9341_MADCTL_MX) wC = emuColMax() - wC;
+	if(g_byIli9341Madctl & ILI9341_MADCTL_MY) wP = emuPageMax() - wP;
+	if(g_byIli9341Madctl & ILI9341_MADCTL_MV)
+		return &pwGram[wC][wP];
+	return &pwGram[wP][wC];
+}
+
+static void emuWindowDefault(void)
+{
+	pwWin[0] = 0;
+	pwWin[1] = emuColMax();
+	pwWin[2] = 0;
+	pwWin[3] = emuPageMax();
+}
+
+static void emuPixel(u16 wColor)
+{
+	if(wCol <= emuColMax() && wPage <= emuPageMax())
+		*emuCell(wCol, wPage) = wColor;
+	if(++wCol > pwWin[1])
+	{
+		wCol = pwWin[0];
+		if(++wPage > pwWin[3])
+			wPage = pwWin[2];
+	}
+}
+
+// Tham so du so byte: cap nhat trang thai theo lenh
+static void emuParam(uint8_t byData)
+{
+	g_ili9341EmuStats.dwParamBytes++;
+	if(byParamCnt < EMU_PARAM_MAX)
+		pbyParam[byParamCnt] = byData;
+	byParamCnt++;
+	if((byCmd == 0x2A || byCmd == 0x2B) && byParamCnt == 4)
+	{
+		u16 wS = pbyParam[0] << 8 | pbyParam[1];
+		u16 wE = pbyParam[2] << 8 | pbyParam[3];
+		u16 wMax = (byCmd == 0x2A) ? emuColMax() : emuPageMax();
+		u16 *pwDst = (byCmd == 0x2A) ? &pwWin[0] : &pwWin[2];
+
+		if(wS > wE || wE > wMax)
+			emuError("window out of range");
+		pwDst[0] = wS;
+		pwDst[1] = wE;
+	}else if(byCmd == 0x36 && byParamCnt == 1)
+	{
+		g_byIli9341Madctl = byData;
+	}
+}
+
+static void emuByte(uint8_t byData)
+{
+	if(byCs)
+	{
+		emuError("byte sent with CS high");
+		return;
+	}
+	if(byRs == 0)
+	{
+		g_ili9341EmuStats.dwCmdBytes++;
+		g_pdwIli9341CmdCnt[byData]++;
+		byCmd = byData;
+		byParamCnt = 0;
+		byPixelHalf = 0;
+		if(byCmd == 0x2A || byCmd == 0x2B)
+			g_ili9341EmuStats.dwWinCmds++;
+		else if(byCmd == 0x2C)
+		{
+			wCol = pwWin[0];
+			wPage = pwWin[2];
+		}
+		return;
+	}
+	if(byCmd == 0x2C || byCmd == 0x3C)
+	{
+		g_ili9341EmuStats.dwPixelBytes++;
+		if(byPixelHalf ^= 1)
+			byPixelHigh = byData;
+		else
+			emuPixel((u16)(byPixelHigh << 8 | byData));
+		return;
+	}
+	emuParam(byData);
+}
+
+// DMA "cham nhat co the": chi day du lieu ra khi CPU cho TC
+static void emuDmaRun(void)
+{
+	const uint8_t *pbyData = (const uint8_t *)(uintptr_t)g_hostDma2Stream3.M0AR;
+
+	for(uint32_t i = 0; i < g_hostDma2Stream3.NDTR; i++)
+		emuByte(pbyData[i]);
+	g_hostDma2Stream3.NDTR = 0;
+	g_hostDma2Stream3.CR &= ~1u;
+	byDmaPending = 0;
+}
+
+SPI_TypeDef *ili9341EmuSpi(void)
+{
+	if(spi1.DR != EMU_DR_EMPTY)
+	{
+		uint8_t byData = spi1.DR;
+
+		spi1.DR = EMU_DR_EMPTY;
+		if(byDmaPending)
+			emuError("CPU write to DR during DMA");
+		emuByte(byData);
+	}
+	spi1.SR = SPI_I2S_FLAG_TXE;
+	return &spi1;
+}
+
+void DMA_Cmd(DMA_Stream_TypeDef *s,int iState)
+{
+	if(iState == ENABLE)
+	{
+		if(byDmaPending)
+			emuError("DMA restarted before TC");
+		s->CR |= 1;
+		byDmaPending = 1;
+	}else
+	{
+		if(byDmaPending)
+			emuError("DMA disabled mid-transfer");
+		byDmaPending = 0;
+		s->CR &= ~1u;
+	}
+}
+
+int DMA_GetFlagStatus(DMA_Stream_TypeDef *s,uint32_t dwFlag)
+{
+	(void)s;
+	if((dwFlag & DMA_FLAG_TCIF3) && byDmaPending)
+		emuDmaRun();
+	return byDmaPending ? RESET : SET;
+}
+
+// Doi RS/CS khi byte cuoi chua ra khoi SPI/DMA se cat mat byte do tren LCD that
+void ili9341EmuPin(u8 byPin,u8 byLevel)
+{
+	if(spi1.DR != EMU_DR_EMPTY || byDmaPending)
+		emuError("CS/RS changed before the last byte was sent");
+	if(byPin == LCD_PIN_CS)
+	{
+		if(byLevel && !byCs)
+			g_ili9341EmuStats.dwCsCycles++;
+		byCs = byLevel;
+	}else
+	{
+		byRs = byLevel;
+	}
+}
+
+void LCD_GPIOInit(void)
+{
+	byCs = 1;
+	byRs = 1;
+}
+
+void LCD_RESET(void)
+{
+	g_byIli9341Madctl = 0;
+	emuWindowDefault();
+	byCmd = 0;
+}
+
+// Giong LCD_direction trong lcd.c; LCD_WriteReg(0x36, x) = 1 lenh + 1 tham so
+void LCD_direction(u8 direction)
+{
+	u8 byMadctl = 0;
+
+	lcddev.setxcmd = 0x2A;
+	lcddev.setycmd = 0x2B;
+	lcddev.wramcmd = 0x2C;
+	switch(direction)
+	{
+	case 0:
+		lcddev.width = LCD_W;
+		lcddev.height = LCD_H;
+		byMadctl = (1<<3);
+		break;
+	case 1:
+		lcddev.width = LCD_H;
+		lcddev.height = LCD_W;
+		byMadctl = (1<<3)|(1<<6)|(1<<5);
+		break;
+	case 2:
+		lcddev.width = LCD_W;
+		lcddev.height = LCD_H;
+		byMadctl = (1<<3)|(1<<6)|(1<<7);
+		break;
+	case 3:
+		lcddev.width = LCD_H;
+		lcddev.height = LCD_W;
+		byMadctl = (1<<3)|(1<<7)|(1<<5);
+		break;
+	default:
+		return;
+	}
+	lcddev.dir = direction;
+	LCD_SeqWriteCmd(0x36, &byMadctl, 1);
+}
+
+void ili9341EmuReset(u16 wFill)
+{
+	for(int y = 0; y < ILI9341_EMU_H; y++)
+		for(int x = 0; x < ILI9341_EMU_W; x++)
+			pwGram[y][x] = wFill;
+	LCD_GPIOInit();
+	LCD_RESET();
+	spi1.DR = EMU_DR_EMPTY;
+	byDmaPending = 0;
+	memset(g_pdwIli9341CmdCnt, 0, sizeof(g_pdwIli9341CmdCnt));
+	ili9341EmuStatsClear();
+}
+
+void ili9341EmuStatsClear(void)
+{
+	memset(&g_ili9341EmuStats, 0, sizeof(g_ili9341EmuStats));
+}
+
+uint32_t ili9341EmuWireUs(uint32_t dwSpiHz)
+{
+	uint64_t qwBits = (uint64_t)(g_ili9341EmuStats.dwCmdBytes + g_ili9341EmuStats.dwParamBytes + \
+								 g_ili9341EmuStats.dwPixelBytes) * 8;
+
+	return dwSpiHz ? (uint32_t)(qwBits * 1000000 / dwSpiHz) : 0;
+}
+
+u16 ili9341EmuPixel(u16 wX,u16 wY)
+{
+	if(wX > emuColMax() || wY > emuPageMax())
+		return 0;
+	return *emuCell(wX, wY);
+}
+
+uint32_t ili9341EmuCrc(void)
+{
+	uint32_t dwCrc = 0xFFFFFFFF;
+
+	for(int y = 0; y < ILI9341_EMU_H; y++)
+		for(int x = 0; x < ILI9341_EMU_W; x++)
+			for(int b = 8; b >= 0; b -= 8)
+			{
+				dwCrc ^= (pwGram[y][x] >> b) & 0xFF;
+				for(int k = 0; k < 8; k++)
+					dwCrc = (dwCrc >> 1) ^ (0xEDB88320 & -(dwCrc & 1));
+			}
+	return ~dwCrc;
+}
+
+// PPM P6 theo huong vat ly (doc), RGB565 mo rong len 8 bit
+int ili9341EmuSavePpm(const char *pcPath)
+{
+	FILE *f = fopen(pcPath, "wb");
+
+	if(f == NULL)
+		return 0;
+	fprintf(f, "P6\n%d %d\n255\n", ILI9341_EMU_W, ILI9341_EMU_H);
+	for(int y = 0; y < ILI9341_EMU_H; y++)
+		for(int x = 0; x < ILI9341_EMU_W; x++)
+		{
+			u16 w = pwGram[y][x];
+			uint8_t pbyRgb[3] = { (w >> 11) * 255 / 31, ((w >> 5) & 0x3F) * 255 / 63, (w & 0x1F) * 255 / 31 };
+			fwrite(pbyRgb, 1, 3, f);
+		}
+	return fclose(f) == 0;
+}
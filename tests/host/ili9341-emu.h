@@ -0,0 +1,71 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: ili9341-emu.h
+ *
+ * Description: ILI9341 gia lap cho tests/host: nhan luong byte SPI (CS/RS, lenh
+ *                            CASET/PASET/RAMWR/MADCTL...) cua lcd-seq.c, ghi vao GRAM 240x320,
+ *                            dem byte tren day va loi giao thuc; xuat PPM de xem.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _ILI9341_EMU_H_
+#define _ILI9341_EMU_H_
+#include <stdint.h>
+#include "lcd.h"
+
+#define ILI9341_EMU_W			240		//Cot vat ly
+#define ILI9341_EMU_H			320		//Hang vat ly
+
+#define ILI9341_MADCTL_MY		0x80
+#define ILI9341_MADCTL_MX		0x40
+#define ILI9341_MADCTL_MV		0x20
+
+typedef struct {
+	uint32_t	dwCmdBytes;			//Byte lenh (RS = 0)
+	uint32_t	dwParamBytes;		//Byte tham so
+	uint32_t	dwPixelBytes;		//Byte GRAM sau RAMWR/RAMWRC
+	uint32_t	dwWinCmds;			//So lenh CASET + PASET
+	uint32_t	dwCsCycles;			//So lan nha CS
+	uint32_t	dwErrors;			//Loi giao thuc, xem ili9341-emu.c
+	const char	*pcFirstError;
+}Ili9341EmuStats_t;
+
+extern Ili9341EmuStats_t g_ili9341EmuStats;
+extern uint32_t g_pdwIli9341CmdCnt[256];	//So lan nhan tung lenh
+extern uint8_t g_byIli9341Madctl;
+
+// Reset cung + xoa bo dem; GRAM to wFill (GRAM that sau reset la rac)
+void ili9341EmuReset(u16 wFill);
+
+void ili9341EmuStatsClear(void);
+
+// Thoi gian tren day SPI cua cac byte da dem: 8 SCK/byte
+uint32_t ili9341EmuWireUs(uint32_t dwSpiHz);
+
+// Doc diem theo toa do logic cua MADCTL hien tai (giong toa do cua lcd-seq)
+u16 ili9341EmuPixel(u16 wX,u16 wY);
+
+uint32_t ili9341EmuCrc(void);
+
+int ili9341EmuSavePpm(const char *pcPath);
+
+#endif
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: ram-flash.c
+ *
+ * Description: Flash gia lap tren RAM cho tests/host (xem ram-flash.h).
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "ram-flash.h"
+
+jmp_buf g_ramFlashReset;
+uint32_t g_ramFlashOps;
+
+static uint32_t pdwSector[2][RAM_FLASH_MAX_SIZE/4];
+static uint32_t dwSectorSize;
+static int iCut = RAM_FLASH_NO_CUT;
+
+static uint32_t *ramWord(uintptr_t dwAddr)
+{
+	for(int s = 0; s < 2; s++)
+	{
+		uintptr_t dwBase = (uintptr_t)pdwSector[s];
+		if(dwAddr >= dwBase && dwAddr < dwBase + dwSectorSize && (dwAddr & 3) == 0)
+			return (uint32_t *)dwAddr;
+	}
+	abort();
+}
+
+// Mat dien giua chung thao tac: tra ve 1 de nguoi goi lam do roi longjmp
+static int ramPowerLost(void)
+{
+	g_ramFlashOps++;
+	if(iCut == RAM_FLASH_NO_CUT) return 0;
+	return iCut-- == 0;
+}
+
+static uint32_t ramRand32(void)
+{
+	return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+static uint8_t ramErase(uint8_t bySector)
+{
+	uint32_t dwWords = dwSectorSize/4;
+
+	if(bySector > 1) return 1;
+	if(ramPowerLost())
+	{
+		//Xoa do: mot phan word da ve 0xFF, phan con lai giu du lieu cu
+		//hoac mang bit bat ky (trang thai khong xac dinh cua o nho)
+		for(uint32_t i = 0; i < dwWords; i++)
+		{
+			switch(rand() % 3)
+			{
+			case 0: pdwSector[bySector][i] = 0xFFFFFFFF; break;
+			case 1: pdwSector[bySector][i] |= ramRand32(); break;
+			default: break;
+			}
+		}
+		longjmp(g_ramFlashReset, 1);
+	}
+	memset(pdwSector[bySector], 0xFF, dwSectorSize);
+	return 0;
+}
+
+static uint8_t ramProgram(uintptr_t dwAddr,uint32_t dwData)
+{
+	uint32_t *pdwWord = ramWord(dwAddr);
+
+	if(ramPowerLost())
+	{
+		//Ghi do: chi mot so bit 0 kip ghi
+		*pdwWord &= dwData | ramRand32();
+		longjmp(g_ramFlashReset, 1);
+	}
+	*pdwWord &= dwData;
+	return (*pdwWord == dwData) ? 0 : 1;
+}
+
+void ramFlashInit(FlashDev_t *pDev,uint32_t dwSize)
+{
+	if(dwSize > RAM_FLASH_MAX_SIZE) abort();
+	dwSectorSize = dwSize;
+	memset(pdwSector, 0xFF, sizeof(pdwSector));
+	g_ramFlashOps = 0;
+	iCut = RAM_FLASH_NO_CUT;
+	pDev->pfErase = ramErase;
+	pDev->pfProgram = ramProgram;
+	pDev->pdwBase[0] = (uintptr_t)pdwSector[0];
+	pDev->pdwBase[1] = (uintptr_t)pdwSector[1];
+	pDev->pbySector[0] = 0;
+	pDev->pbySector[1] = 1;
+	pDev->dwSize = dwSize;
+}
+
+void ramFlashCutAt(int iOps)
+{
+	iCut = iOps;
+}
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: ram-flash.h
+ *
+ * Description: Flash gia lap tren RAM cho tests/host: 2 sector xoa = 0xFF, ghi = AND,
+ *              co the cat dien o thao tac thu N (ghi do 1 word / xoa do sector) roi
+ *              longjmp ve diem reset cua bai test.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+// Enclosing macro to prevent multiple inclusion
+#ifndef _RAM_FLASH_H_
+#define _RAM_FLASH_H_
+#include <setjmp.h>
+#include <stdint.h>
+#include "flash-sector.h"
+
+#define RAM_FLASH_MAX_SIZE		4096
+#define RAM_FLASH_NO_CUT		(-1)
+
+extern jmp_buf g_ramFlashReset;
+extern uint32_t g_ramFlashOps;			//So thao tac xoa/ghi tu luc ramFlashInit
+
+void ramFlashInit(FlashDev_t *pDev,uint32_t dwSize);
+
+// Cat dien o thao tac thu iOps (dem tu 0) ke tu bay gio, RAM_FLASH_NO_CUT de tat
+void ramFlashCutAt(int iOps);
+
+#endif
@@ -0,0 +1,9 @@
+/* Host stub of GUI.h (GUI.c is not in this tree) */
+#ifndef __GUI_H
+#define __GUI_H
+#include "lcd.h"
+void Show_Str(u16 x,u16 y,u16 fc,u16 bc,u8 *str,u8 size,u8 mode);
+void LCD_ShowChar(u16 x,u16 y,u16 fc,u16 bc,u8 num,u8 size,u8 mode);
+void LCD_ShowTitle(u16 sizeBox,u16 fc,u16 bc,u8 *str,u8 size,u8 mode);
+u16 LCD_ShowOption(u16 sizeBox,u16 y,u16 fc,u16 bc,u8 *str,u8 size,u8 mode);
+#endif
@@ -0,0 +1,23 @@
+/* Host stub of button-v1-1.h: the pins are a global the test drives, 0 while
+ * pressed like the real pull-up inputs */
+#ifndef _BUTTON_V1_1_H_
+#define _BUTTON_V1_1_H_
+#include <stdint.h>
+
+typedef enum {
+	NOKEY,
+	UP,
+	DOWN,
+	SELECT,
+	RETURN,
+	LEFT,
+	RIGHT
+}ValueKey_e;
+
+extern uint8_t g_pbyHostPin[5];
+#define BTN1_GET				g_pbyHostPin[0]
+#define BTN2_GET				g_pbyHostPin[1]
+#define BTN3_GET				g_pbyHostPin[2]
+#define BTN4_GET				g_pbyHostPin[3]
+#define BTN5_GET				g_pbyHostPin[4]
+#endif
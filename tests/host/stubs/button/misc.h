@@ -0,0 +1,16 @@
+/* Host stub of misc.h (NVIC) used by button-scan.c */
+#ifndef __MISC_H
+#define __MISC_H
+#include <stdint.h>
+
+#define TIM3_IRQn				29
+
+typedef struct {
+	uint8_t NVIC_IRQChannel;
+	uint8_t NVIC_IRQChannelPreemptionPriority;
+	uint8_t NVIC_IRQChannelSubPriority;
+	int NVIC_IRQChannelCmd;
+}NVIC_InitTypeDef;
+
+static inline void NVIC_Init(NVIC_InitTypeDef *p) { (void)p; }
+#endif
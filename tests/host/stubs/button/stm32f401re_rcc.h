@@ -0,0 +1,32 @@
+/* Host stub of the RCC driver used by button-scan.c: no clock tree, only the
+ * names buttonScanInit needs to compile */
+#ifndef __STM32F401RE_RCC_H
+#define __STM32F401RE_RCC_H
+#include <stdint.h>
+
+#define ENABLE					1
+#define RCC_APB1Periph_TIM3		0x00000002
+#define RCC_CFGR_PPRE1			0x00001C00
+
+typedef struct {
+	uint32_t CFGR;
+}RCC_TypeDef;
+
+typedef struct {
+	uint32_t PCLK1_Frequency;
+}RCC_ClocksTypeDef;
+
+static RCC_TypeDef hostRcc;
+#define RCC						(&hostRcc)
+
+static inline void RCC_GetClocksFreq(RCC_ClocksTypeDef *p)
+{
+	p->PCLK1_Frequency = 42000000;
+}
+
+static inline void RCC_APB1PeriphClockCmd(uint32_t dwPeriph,int iState)
+{
+	(void)dwPeriph;
+	(void)iState;
+}
+#endif
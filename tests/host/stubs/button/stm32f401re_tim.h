@@ -0,0 +1,32 @@
+/* Host stub of the TIM driver used by button-scan.c: TIM3 is a plain struct,
+ * the test sets SR.UIF and calls TIM3_IRQHandler to run one 1 ms scan */
+#ifndef __STM32F401RE_TIM_H
+#define __STM32F401RE_TIM_H
+#include <stdint.h>
+
+#define TIM_SR_UIF				0x0001
+#define TIM_FLAG_Update			0x0001
+#define TIM_IT_Update			0x0001
+#define TIM_CounterMode_Up		0x0000
+#define TIM_CKD_DIV1			0x0000
+
+typedef struct {
+	volatile uint16_t SR;
+}TIM_TypeDef;
+
+typedef struct {
+	uint16_t TIM_Prescaler;
+	uint16_t TIM_CounterMode;
+	uint32_t TIM_Period;
+	uint16_t TIM_ClockDivision;
+}TIM_TimeBaseInitTypeDef;
+
+extern TIM_TypeDef g_hostTim3;			//Defined by the test
+#define TIM3					(&g_hostTim3)
+
+static inline void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef *p) { (void)p; }
+static inline void TIM_TimeBaseInit(TIM_TypeDef *t,TIM_TimeBaseInitTypeDef *p) { (void)t; (void)p; }
+static inline void TIM_ClearFlag(TIM_TypeDef *t,uint16_t w) { t->SR &= ~w; }
+static inline void TIM_ITConfig(TIM_TypeDef *t,uint16_t w,int i) { (void)t; (void)w; (void)i; }
+static inline void TIM_Cmd(TIM_TypeDef *t,int i) { (void)t; (void)i; }
+#endif
@@ -0,0 +1,34 @@
+/* Host stub of the CMSIS SIMD intrinsics used by swar-kernels.c, so the
+ * __ARM_FEATURE_DSP path can be checked on a PC (GE flags kept in a global) */
+#ifndef __STM32F401RE_H
+#define __STM32F401RE_H
+#include <stdint.h>
+
+static uint32_t dwHostGe;
+
+static inline uint32_t __REV16(uint32_t v)
+{
+	return ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+}
+
+static inline uint32_t __UADD8(uint32_t a,uint32_t b)
+{
+	uint32_t r = 0;
+	dwHostGe = 0;
+	for(int i = 0; i < 4; i++)
+	{
+		uint32_t s = ((a >> (8*i)) & 0xFF) + ((b >> (8*i)) & 0xFF);
+		if(s > 0xFF) dwHostGe |= 1u << i;
+		r |= (s & 0xFF) << (8*i);
+	}
+	return r;
+}
+
+static inline uint32_t __SEL(uint32_t a,uint32_t b)
+{
+	uint32_t r = 0;
+	for(int i = 0; i < 4; i++)
+		r |= (((dwHostGe >> i) & 1) ? a : b) & (0xFFu << (8*i));
+	return r;
+}
+#endif
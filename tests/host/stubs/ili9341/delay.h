@@ -0,0 +1,6 @@
+/* Host stub of delay.h: the emulated panel has no timing */
+#ifndef __DELAY_H
+#define __DELAY_H
+#include <stdint.h>
+static inline void delay_ms(uint32_t dw) { (void)dw; }
+#endif
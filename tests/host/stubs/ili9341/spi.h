@@ -0,0 +1,5 @@
+/* Host stub of spi.h (spi.c is not in this tree) */
+#ifndef __SPI_H
+#define __SPI_H
+static inline void SPI1_Init(void) {}
+#endif
@@ -0,0 +1,56 @@
+/* Host stub of the DMA driver used by lcd-seq.c. A started transfer is only
+ * shifted out when the CPU waits for TC: the emulated DMA is as slow as it
+ * may be, so a line buffer reused too early shows up in the frame */
+#ifndef __STM32F401RE_DMA_H
+#define __STM32F401RE_DMA_H
+#include <stdint.h>
+#include "stm32f401re_rcc.h"
+
+#define DMA_Channel_3						0x06000000
+#define DMA_FLAG_FEIF3						0x10400001
+#define DMA_FLAG_DMEIF3						0x10400004
+#define DMA_FLAG_TEIF3						0x10400008
+#define DMA_FLAG_HTIF3						0x10400010
+#define DMA_FLAG_TCIF3						0x10400020
+#define DMA_DIR_MemoryToPeripheral			0x00000040
+#define DMA_PeripheralInc_Disable			0x00000000
+#define DMA_MemoryInc_Enable				0x00000400
+#define DMA_PeripheralDataSize_Byte			0x00000000
+#define DMA_MemoryDataSize_Byte				0x00000000
+#define DMA_Mode_Normal						0x00000000
+#define DMA_Priority_High					0x00020000
+
+typedef struct {
+	volatile uint32_t CR;
+	volatile uint32_t NDTR;
+	volatile uint32_t PAR;
+	volatile uint32_t M0AR;				//32-bit address: the test links -no-pie
+}DMA_Stream_TypeDef;
+
+typedef struct {
+	uint32_t DMA_Channel;
+	uint32_t DMA_PeripheralBaseAddr;
+	uint32_t DMA_Memory0BaseAddr;
+	uint32_t DMA_DIR;
+	uint32_t DMA_BufferSize;
+	uint32_t DMA_PeripheralInc;
+	uint32_t DMA_MemoryInc;
+	uint32_t DMA_PeripheralDataSize;
+	uint32_t DMA_MemoryDataSize;
+	uint32_t DMA_Mode;
+	uint32_t DMA_Priority;
+}DMA_InitTypeDef;
+
+extern DMA_Stream_TypeDef g_hostDma2Stream3;		//Defined by ili9341-emu.c
+#define DMA2_Stream3						(&g_hostDma2Stream3)
+
+static inline void DMA_DeInit(DMA_Stream_TypeDef *s) { s->CR = 0; }
+static inline void DMA_StructInit(DMA_InitTypeDef *p) { (void)p; }
+static inline void DMA_Init(DMA_Stream_TypeDef *s,DMA_InitTypeDef *p) { (void)s; (void)p; }
+static inline void DMA_SetCurrDataCounter(DMA_Stream_TypeDef *s,uint16_t w) { s->NDTR = w; }
+static inline int DMA_GetCmdStatus(DMA_Stream_TypeDef *s) { return s->CR & 1; }
+static inline void DMA_ClearFlag(DMA_Stream_TypeDef *s,uint32_t dw) { (void)s; (void)dw; }
+
+void DMA_Cmd(DMA_Stream_TypeDef *s,int iState);
+int DMA_GetFlagStatus(DMA_Stream_TypeDef *s,uint32_t dwFlag);
+#endif
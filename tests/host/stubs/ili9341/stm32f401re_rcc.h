@@ -0,0 +1,27 @@
+/* Host stub of the RCC driver used by lcd-seq.c; also has the names of
+ * stubs/uart/stm32f401re_rcc.h (same guard) for tests that link both
+ * lcd-seq.c and uart-channel.c */
+#ifndef __STM32F401RE_RCC_H
+#define __STM32F401RE_RCC_H
+#include <stdint.h>
+
+#define RESET					0
+#define SET						1
+#define DISABLE					0
+#define ENABLE					1
+#define RCC_FLAG_BORRST			0x79
+#define RCC_FLAG_PORRST			0x7B
+#define RCC_AHB1Periph_DMA2		0x00400000
+#define RCC_AHB1Periph_GPIOA	0x00000001
+#define RCC_APB2Periph_USART1	0x00000010
+
+extern int g_iHostPowerOnReset;			//1: LCD_SeqInit runs the cold init table
+
+static inline int RCC_GetFlagStatus(uint8_t byFlag)
+{
+	return (byFlag == RCC_FLAG_PORRST) ? g_iHostPowerOnReset : RESET;
+}
+static inline void RCC_ClearFlag(void) {}
+static inline void RCC_AHB1PeriphClockCmd(uint32_t dw,int i) { (void)dw; (void)i; }
+static inline void RCC_APB2PeriphClockCmd(uint32_t dw,int i) { (void)dw; (void)i; }
+#endif
@@ -0,0 +1,22 @@
+/* Host stub of the SPI driver used by lcd-seq.c. SPI1 is evaluated through
+ * ili9341EmuSpi() on every access, so a byte left in DR by the previous
+ * access is shifted into the emulated panel before the next one */
+#ifndef __STM32F401RE_SPI_H
+#define __STM32F401RE_SPI_H
+#include <stdint.h>
+#include "stm32f401re_rcc.h"
+
+#define SPI_I2S_FLAG_TXE		0x0002
+#define SPI_I2S_FLAG_BSY		0x0080
+#define SPI_I2S_DMAReq_Tx		0x0002
+
+typedef struct {
+	volatile uint16_t SR;
+	volatile uint16_t DR;
+}SPI_TypeDef;
+
+SPI_TypeDef *ili9341EmuSpi(void);
+#define SPI1					(ili9341EmuSpi())
+
+static inline void SPI_I2S_DMACmd(SPI_TypeDef *p,uint16_t w,int i) { (void)p; (void)w; (void)i; }
+#endif
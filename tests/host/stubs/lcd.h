@@ -0,0 +1,49 @@
+/* Host stub of lcd.h (lcd.c is not in this tree): types, colours and lcddev */
+#ifndef __LCD_H
+#define __LCD_H
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+
+typedef struct {
+	u16 width;
+	u16 height;
+	u16 id;
+	u8 dir;
+	u16 wramcmd;
+	u16 setxcmd;
+	u16 setycmd;
+}_lcd_dev;
+
+extern _lcd_dev lcddev;
+extern u16 POINT_COLOR;
+extern u16 BACK_COLOR;
+
+#define LCD_W		240
+#define LCD_H		320
+#define USE_HORIZONTAL	0
+
+/* Control pins and the lcd.c calls made by lcd-seq.c, implemented by
+ * ili9341-emu.c for the tests that link it */
+#define LCD_PIN_CS	0
+#define LCD_PIN_RS	1
+void ili9341EmuPin(u8 byPin,u8 byLevel);
+#define LCD_CS_SET	ili9341EmuPin(LCD_PIN_CS, 1)
+#define LCD_CS_CLR	ili9341EmuPin(LCD_PIN_CS, 0)
+#define LCD_RS_SET	ili9341EmuPin(LCD_PIN_RS, 1)
+#define LCD_RS_CLR	ili9341EmuPin(LCD_PIN_RS, 0)
+extern u8 g_byHostLcdLed;
+#define LCD_LED		g_byHostLcdLed
+void LCD_GPIOInit(void);
+void LCD_RESET(void);
+void LCD_direction(u8 direction);
+
+#define WHITE		0xFFFF
+#define BLACK		0x0000
+#define BLUE		0x001F
+#define RED			0xF800
+#define GREEN		0x07E0
+#define CYAN		0x7FFF
+#endif
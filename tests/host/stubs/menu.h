@@ -0,0 +1,11 @@
+/* Host stub of menu.h: menu.c is not in this tree, only the test modes */
+#ifndef _MENU_H_
+#define _MENU_H_
+
+typedef enum {
+	NONE,
+	DUAL_MODE,
+	ZIGBEE_MODE,
+	BLE_MODE
+}TestSwMode_e;
+#endif
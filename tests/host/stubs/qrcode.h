@@ -0,0 +1,25 @@
+/* Host stub of qrcode.h (App/Middle/qr-code is not in this tree): same API,
+ * the test that links result-pane.c provides a fake encoder */
+#ifndef __QRCODE_H_
+#define __QRCODE_H_
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ECC_LOW				0
+#define ECC_MEDIUM			1
+#define ECC_QUARTILE		2
+#define ECC_HIGH			3
+
+typedef struct QrCode {
+	uint8_t version;
+	uint8_t size;
+	uint8_t ecc;
+	uint8_t mode;
+	uint8_t mask;
+	uint8_t *modules;
+}QRCode;
+
+uint16_t qrcode_getBufferSize(uint8_t version);
+int8_t qrcode_initText(QRCode *qrcode,uint8_t *modules,uint8_t version,uint8_t ecc,const char *data);
+bool qrcode_getModule(QRCode *qrcode,uint8_t x,uint8_t y);
+#endif
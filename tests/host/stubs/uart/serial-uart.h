@@ -0,0 +1,7 @@
+/* Host stub of serial-uart.h: serial-uart.c (USART6) is not in this tree,
+ * uart-channel.c only needs the baud rate */
+#ifndef _SERIAL_UART_H_
+#define _SERIAL_UART_H_
+
+#define USART6_BAUDRATE			115200
+#endif
@@ -0,0 +1,31 @@
+/* Host stub of the GPIO driver used by uart-channel.c */
+#ifndef __STM32F401RE_GPIO_H
+#define __STM32F401RE_GPIO_H
+#include <stdint.h>
+
+#define GPIO_Mode_AF			0x02
+#define GPIO_OType_PP			0x00
+#define GPIO_PuPd_UP			0x01
+#define GPIO_Speed_100MHz		0x03
+#define GPIO_Pin_10				0x0400
+#define GPIO_PinSource10		0x0A
+#define GPIO_AF_USART1			0x07
+
+typedef struct {
+	uint32_t GPIO_Pin;
+	int GPIO_Mode;
+	int GPIO_Speed;
+	int GPIO_OType;
+	int GPIO_PuPd;
+}GPIO_InitTypeDef;
+
+typedef struct {
+	uint32_t MODER;
+}GPIO_TypeDef;
+
+static GPIO_TypeDef hostGpioA;
+#define GPIOA					(&hostGpioA)
+
+static inline void GPIO_Init(GPIO_TypeDef *g,GPIO_InitTypeDef *p) { (void)g; (void)p; }
+static inline void GPIO_PinAFConfig(GPIO_TypeDef *g,uint16_t w,uint8_t by) { (void)g; (void)w; (void)by; }
+#endif
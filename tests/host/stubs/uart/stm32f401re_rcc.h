@@ -0,0 +1,15 @@
+/* Host stub of the RCC driver used by uart-channel.c: only the names
+ * uartChannelAuxInit needs to compile */
+#ifndef __STM32F401RE_RCC_H
+#define __STM32F401RE_RCC_H
+#include <stdint.h>
+
+#define DISABLE					0
+#define ENABLE					1
+#define SET						1
+#define RCC_AHB1Periph_GPIOA	0x00000001
+#define RCC_APB2Periph_USART1	0x00000010
+
+static inline void RCC_AHB1PeriphClockCmd(uint32_t dwPeriph,int iState) { (void)dwPeriph; (void)iState; }
+static inline void RCC_APB2PeriphClockCmd(uint32_t dwPeriph,int iState) { (void)dwPeriph; (void)iState; }
+#endif
@@ -0,0 +1,37 @@
+/* Host stub of the USART driver used by uart-channel.c: USART1 is a plain
+ * struct, the test drives bytes through uartChannelPutByte like the ISR */
+#ifndef __STM32F401RE_USART_H
+#define __STM32F401RE_USART_H
+#include <stdint.h>
+
+#define USART_IT_RXNE						0x0525
+#define USART_HardwareFlowControl_None		0x0000
+#define USART_Mode_Rx						0x0004
+#define USART_Parity_No						0x0000
+#define USART_StopBits_1					0x0000
+#define USART_WordLength_8b					0x0000
+
+typedef struct {
+	uint32_t USART_BaudRate;
+	uint16_t USART_WordLength;
+	uint16_t USART_StopBits;
+	uint16_t USART_Parity;
+	uint16_t USART_Mode;
+	uint16_t USART_HardwareFlowControl;
+}USART_InitTypeDef;
+
+typedef struct {
+	volatile uint16_t SR;
+	volatile uint16_t DR;
+}USART_TypeDef;
+
+static USART_TypeDef hostUsart1;
+#define USART1								(&hostUsart1)
+
+static inline void USART_Init(USART_TypeDef *u,USART_InitTypeDef *p) { (void)u; (void)p; }
+static inline void USART_Cmd(USART_TypeDef *u,int i) { (void)u; (void)i; }
+static inline void USART_ITConfig(USART_TypeDef *u,uint16_t w,int i) { (void)u; (void)w; (void)i; }
+static inline int USART_GetITStatus(USART_TypeDef *u,uint16_t w) { (void)w; return u->SR != 0; }
+static inline uint16_t USART_ReceiveData(USART_TypeDef *u) { return u->DR; }
+static inline void USART_ClearITPendingBit(USART_TypeDef *u,uint16_t w) { (void)w; u->SR = 0; }
+#endif
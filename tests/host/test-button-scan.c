@@ -0,0 +1,199 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-button-scan.c
+ *
+ * Description: Kiem tra button-scan tren PC: nhan doi (bounce) ngau nhien, nhan 1/2/3
+ *                            lan, giu; buttonScanFlush bo phim nhan luc doi man hinh.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "stm32f401re_tim.h"
+#include "button-scan.h"
+
+#define BOUNCE_MS				6		//Nho hon BUTTON_SCAN_DEBOUNCE_MS
+#define PRESS_MS				60
+#define GAP_MS					120		//Nho hon BUTTON_SCAN_GAP_MS
+#define SEEDS					200
+
+uint8_t g_pbyHostPin[5] = {1, 1, 1, 1, 1};
+TIM_TypeDef g_hostTim3;
+
+void TIM3_IRQHandler(void);
+
+static int iFail;
+
+static void expect(int iOk,const char *pcWhat,unsigned i)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (%u)\n", pcWhat, i);
+		iFail++;
+	}
+}
+
+// Chay n lan quet 1 ms
+static void tickMs(uint16_t wMs)
+{
+	while(wMs--)
+	{
+		TIM3->SR = TIM_SR_UIF;
+		TIM3_IRQHandler();
+	}
+}
+
+// Chuyen muc chan qua BOUNCE_MS nhieu ngau nhien roi giu on dinh
+static void edge(uint8_t byButton,uint8_t byPressed)
+{
+	for(int i = 0; i < BOUNCE_MS; i++)
+	{
+		g_pbyHostPin[byButton] = rand() & 1;
+		tickMs(1);
+	}
+	g_pbyHostPin[byButton] = !byPressed;
+}
+
+static void press(uint8_t byButton,uint16_t wHoldMs,uint16_t wGapMs)
+{
+	edge(byButton, 1);
+	tickMs(wHoldMs);
+	edge(byButton, 0);
+	tickMs(wGapMs);
+}
+
+static void reset(void)
+{
+	for(int i = 0; i < 5; i++)
+		g_pbyHostPin[i] = 1;
+	buttonScanInit();
+}
+
+// Lay het su kien; tra ve so su kien, luu su kien dau tien vao pFirst
+static int drain(ButtonScanEvent_t *pFirst)
+{
+	ButtonScanEvent_t event;
+	int iCnt = 0;
+
+	while(buttonScanGetEvent(&event))
+	{
+		if(iCnt++ == 0)
+			*pFirst = event;
+	}
+	return iCnt;
+}
+
+// 1 nut, iPresses lan nhan ngan (0 = giu), ky vong dung 1 su kien byEvent
+static void checkPattern(uint8_t byButton,int iPresses,uint8_t byEvent,const char *pcWhat,unsigned s)
+{
+	ButtonScanEvent_t event = {0, 0};
+
+	reset();
+	if(iPresses == 0)
+	{
+		press(byButton, BUTTON_SCAN_HOLD_MS + 200, 0);
+	}
+	for(int i = 0; i < iPresses; i++)
+	{
+		press(byButton, PRESS_MS, GAP_MS);
+	}
+	tickMs(BUTTON_SCAN_GAP_MS + 50);
+	expect(drain(&event) == 1, pcWhat, s);
+	expect(event.byButton == byButton && event.byEvent == byEvent, pcWhat, s);
+}
+
+// Thoi gian tu luc nha (on dinh) toi khi co su kien PRESS_1
+static int latencyMs(void)
+{
+	ButtonScanEvent_t event;
+	int iMs = 0;
+
+	reset();
+	edge(0, 1);
+	tickMs(PRESS_MS);
+	edge(0, 0);
+	while(!buttonScanGetEvent(&event) && iMs < 1000)
+	{
+		tickMs(1);
+		iMs++;
+	}
+	return iMs;
+}
+
+int main(void)
+{
+	ButtonScanEvent_t event;
+
+	for(unsigned s = 0; s < SEEDS; s++)
+	{
+		srand(s);
+		checkPattern(s % BUTTON_SCAN_CNT, 1, BUTTON_SCAN_EVT_PRESS_1, "bouncy single", s);
+		checkPattern(s % BUTTON_SCAN_CNT, 2, BUTTON_SCAN_EVT_PRESS_2, "double", s);
+		checkPattern(s % BUTTON_SCAN_CNT, 3, BUTTON_SCAN_EVT_PRESS_3, "triple", s);
+		checkPattern(s % BUTTON_SCAN_CNT, 4, BUTTON_SCAN_EVT_PRESS_3, "4 presses clamp to 3", s);
+		checkPattern(s % BUTTON_SCAN_CNT, 0, BUTTON_SCAN_EVT_HOLD, "hold, no press on release", s);
+	}
+	printf("press -> event latency after release: %d ms\n", latencyMs());
+
+	//Bang phim cua buttonScanProcess
+	reset();
+	press(0, PRESS_MS, BUTTON_SCAN_GAP_MS + 10);
+	expect(buttonScanProcess() == SELECT, "BTN1 x1 = SELECT", 0);
+	press(0, BUTTON_SCAN_HOLD_MS + 50, BUTTON_SCAN_GAP_MS + 10);
+	expect(buttonScanProcess() == RETURN, "BTN1 hold = RETURN", 0);
+	press(1, PRESS_MS, BUTTON_SCAN_GAP_MS + 10);
+	expect(buttonScanProcess() == UP, "BTN2 x1 = UP", 0);
+	press(2, PRESS_MS, GAP_MS);
+	press(2, PRESS_MS, BUTTON_SCAN_GAP_MS + 10);
+	expect(buttonScanProcess() == NOKEY, "BTN3 x2 ignored", 0);
+
+	//Nhan luc splash (delay 2 s) roi vao menu: bo het
+	reset();
+	press(0, PRESS_MS, GAP_MS);
+	press(3, PRESS_MS, 2000 - 2*(PRESS_MS + GAP_MS));
+	buttonScanFlush();
+	expect(buttonScanProcess() == NOKEY, "flush drops queued keys", 0);
+
+	//Flush giua chuoi nhan: lan nhan truoc khong duoc tinh
+	reset();
+	press(0, PRESS_MS, GAP_MS);
+	buttonScanFlush();
+	tickMs(BUTTON_SCAN_GAP_MS + 50);
+	expect(drain(&event) == 0, "flush cancels a pending sequence", 0);
+	press(0, PRESS_MS, BUTTON_SCAN_GAP_MS + 50);
+	expect(drain(&event) == 1 && event.byEvent == BUTTON_SCAN_EVT_PRESS_1, "single after flush", 0);
+
+	//Flush khi dang giu: khong HOLD, khong PRESS khi nha
+	reset();
+	edge(0, 1);
+	tickMs(BUTTON_SCAN_HOLD_MS / 2);
+	buttonScanFlush();
+	tickMs(BUTTON_SCAN_HOLD_MS);
+	edge(0, 0);
+	tickMs(BUTTON_SCAN_GAP_MS + 50);
+	expect(drain(&event) == 0, "flush while held", 0);
+	press(0, PRESS_MS, GAP_MS);
+	press(0, PRESS_MS, BUTTON_SCAN_GAP_MS + 50);
+	expect(drain(&event) == 1 && event.byEvent == BUTTON_SCAN_EVT_PRESS_2, "double after held flush", 0);
+
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-config-store.c
+ *
+ * Description: Kiem tra config-store tren flash RAM gia lap: cat dien o moi thao tac
+ *              xoa/ghi cua chuoi lan luu (ban ghi ghi do, xoa sector do), khoi dong lai
+ *              va kiem tra cau hinh doc duoc la ban luu xong cuoi cung.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ram-flash.h"
+#include "config-store.h"
+
+// Ban ghi 16 byte: 4 o moi sector de doi sector thuong xuyen
+#define SECTOR_SIZE				64
+#define SAVE_CNT				12
+
+static FlashDev_t dev;
+static volatile int iDone;
+static int iFail;
+
+static StationConfig_t cfgOf(int i)
+{
+	StationConfig_t cfg;
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.byTestMode = i;		//Moi lan luu mot gia tri khac nhau
+	cfg.byAutoDetect = (i >> 1) & 1;
+	return cfg;
+}
+
+static void expect(int iOk,const char *pcWhat,int iCut,int i)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (cut %d, %d)\n", pcWhat, iCut, i);
+		iFail++;
+	}
+}
+
+static void runScript(void)
+{
+	ConfigStore_t store;
+	StationConfig_t cfg;
+
+	configStoreInit(&store, &dev, &cfg);
+	for(int i = 1; i <= SAVE_CNT; i++)
+	{
+		cfg = cfgOf(i);
+		if(configStoreSave(&store, &cfg) != 0) return;
+		iDone = i;
+	}
+}
+
+// Sau khi khoi dong lai: doc dung ban luu xong cuoi, va luu tiep binh thuong
+static void checkAfterReset(int iCut)
+{
+	ConfigStore_t store;
+	StationConfig_t cfg, want;
+	uint8_t byOk;
+
+	memset(&cfg, 0, sizeof(cfg));
+	byOk = configStoreInit(&store, &dev, &cfg);
+	want = cfgOf(iDone);
+	if(iDone == 0)
+		expect(byOk == 0, "blank store reports no config", iCut, 0);
+	else
+		expect(byOk && !memcmp(&cfg, &want, sizeof(cfg)), "last committed config", iCut, iDone);
+
+	for(int j = 1; j <= 6; j++)
+	{
+		want = cfgOf(100 + j);
+		expect(configStoreSave(&store, &want) == 0, "save after reset", iCut, j);
+		memset(&cfg, 0, sizeof(cfg));
+		byOk = configStoreInit(&store, &dev, &cfg);
+		expect(byOk && !memcmp(&cfg, &want, sizeof(cfg)), "reload after reset", iCut, j);
+	}
+}
+
+int main(void)
+{
+	//Giu qua longjmp
+	static uint32_t dwOps, n;
+	static int iCuts;
+
+	//Chay khong cat dien de biet so thao tac
+	ramFlashInit(&dev, SECTOR_SIZE);
+	iDone = 0;
+	runScript();
+	dwOps = g_ramFlashOps;
+	expect(iDone == SAVE_CNT, "uninterrupted script", -1, iDone);
+	checkAfterReset(-1);
+
+	for(int iSeed = 0; iSeed < 4; iSeed++)
+	{
+		for(n = 0; n < dwOps; n++)
+		{
+			srand(n*7 + iSeed);
+			ramFlashInit(&dev, SECTOR_SIZE);
+			iDone = 0;
+			if(setjmp(g_ramFlashReset) == 0)
+			{
+				ramFlashCutAt(n);
+				runScript();
+			}
+			ramFlashCutAt(RAM_FLASH_NO_CUT);
+			checkAfterReset(n);
+			iCuts++;
+		}
+	}
+	printf("%u flash ops per script, %d power cuts replayed\n", dwOps, iCuts);
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-display-list.c
+ *
+ * Description: Kiem tra phat lai danh sach lenh theo dong quet tren LCD gia lap: so
+ *              sanh voi cach ve tung lenh qua GUI (Show_Str/LCD_ShowChar/LCD_Fill) va
+ *              dem so cua so, so byte gui khi ve lan dau va khi doi gia tri truong.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd-seq.h"
+#include "display-list.h"
+
+#define FIELD_CNT				4
+#define FC						BLACK
+#define BC						WHITE
+#define LINE_COLOR				RED
+#define GARBAGE					0x1234
+
+_lcd_dev lcddev = { LCD_W, LCD_H, 0x9341, 0, 0x2C, 0x2A, 0x2B };
+u16 POINT_COLOR = LINE_COLOR;
+u16 BACK_COLOR = WHITE;
+// Trong GUI.c la bang const; o day dien ngau nhien luc chay
+unsigned char asc2_1206[95][12];
+unsigned char asc2_1608[95][16];
+
+static u16 pwFb[LCD_H][LCD_W];
+static u16 pwRef[LCD_H][LCD_W];
+static u8 pbyLine[LCD_SEQ_LINE_MAX];
+static u16 pwWin[4];
+static uint32_t dwCursor;
+static uint32_t dwWinCnt;
+static uint32_t dwBytes;
+static int iFail;
+
+/* Gia lap lcd-seq: cua so + ghi diem tuan tu nhu ILI9341 */
+static void fbPut(u16 wColor)
+{
+	u16 w = pwWin[2] - pwWin[0] + 1;
+	u16 x = pwWin[0] + dwCursor % w;
+	u16 y = pwWin[1] + dwCursor / w;
+
+	if(y <= pwWin[3] && x < LCD_W && y < LCD_H)
+		pwFb[y][x] = wColor;
+	dwCursor++;
+}
+
+void LCD_SeqInvalidate(void) {}
+
+void LCD_SeqFill(u16 wXs,u16 wYs,u16 wXe,u16 wYe,u16 wColor)
+{
+	pwWin[0] = wXs; pwWin[1] = wYs; pwWin[2] = wXe; pwWin[3] = wYe;
+	dwCursor = 0;
+	dwWinCnt++;
+	for(uint32_t i = 0; i < (uint32_t)(wXe - wXs + 1)*(wYe - wYs + 1); i++)
+		fbPut(wColor);
+	dwBytes += (uint32_t)(wXe - wXs + 1)*(wYe - wYs + 1)*2;
+}
+
+void LCD_SeqLineBegin(u16 wXs,u16 wYs,u16 wXe,u16 wYe)
+{
+	pwWin[0] = wXs; pwWin[1] = wYs; pwWin[2] = wXe; pwWin[3] = wYe;
+	dwCursor = 0;
+	dwWinCnt++;
+}
+
+u8 *LCD_SeqLineGet(void)
+{
+	memset(pbyLine, 0xA5, sizeof(pbyLine));
+	return pbyLine;
+}
+
+void LCD_SeqLinePut(u16 wBytes)
+{
+	if(wBytes != (pwWin[2] - pwWin[0] + 1)*2)
+	{
+		printf("line of %u bytes in a %u wide window\n", wBytes, pwWin[2] - pwWin[0] + 1);
+		iFail++;
+	}
+	for(u16 i = 0; i < wBytes; i += 2)
+		fbPut((u16)(pbyLine[i] << 8 | pbyLine[i + 1]));
+	dwBytes += wBytes;
+}
+
+void LCD_SeqLineEnd(void)
+{
+	if(dwCursor != (uint32_t)(pwWin[2] - pwWin[0] + 1)*(pwWin[3] - pwWin[1] + 1))
+	{
+		printf("window not filled: %u pixels\n", dwCursor);
+		iFail++;
+	}
+}
+
+/* Tham chieu: ve tung lenh bang thuat toan cua GUI.c */
+static void refChar(int x,int y,char c,int size)
+{
+	unsigned char b;
+
+	for(int r = 0; r < size; r++)
+	{
+		b = (size == 12) ? asc2_1206[c - ' '][r] : asc2_1608[c - ' '][r];
+		for(int t = 0; t < size/2; t++, b >>= 1)
+			if(x + t < LCD_W && y + r < LCD_H)
+				pwRef[y + r][x + t] = (b & 1) ? FC : BC;
+	}
+}
+
+static void refFill(int xs,int ys,int xe,int ye,u16 c)
+{
+	for(int y = ys; y <= ye && y < LCD_H; y++)
+		for(int x = xs; x <= xe && x < LCD_W; x++)
+			pwRef[y][x] = c;
+}
+
+static void refRender(DisplayList_t *pDl,const char * const *ppValue)
+{
+	DlCmd_t *p;
+	const char *s;
+
+	for(int i = 0; i < pDl->byCount; i++)
+	{
+		p = &pDl->pCmd[i];
+		if(p->byOp == DL_OP_CLEAR)
+			refFill(p->wXs, p->wYs, p->wXe, p->wYe, BC);
+		else if(p->byOp != DL_OP_HLINE)
+		{
+			s = (p->byOp == DL_OP_TEXT) ? p->pStr : ppValue[p->byField];
+			for(int k = 0, x = p->wXs; s && s[k] && k < DL_FIELD_MAX_LEN; k++, x += p->bySize/2)
+			{
+				if(x > LCD_W - p->bySize/2) break;
+				refChar(x, p->wYs, s[k], p->bySize);
+			}
+		}
+	}
+	//Duong ke ve sau cung (dlReplay truoc day cung ve duong ke o buoc cuoi)
+	for(int i = 0; i < pDl->byCount; i++)
+	{
+		p = &pDl->pCmd[i];
+		if(p->byOp == DL_OP_HLINE)
+			refFill(p->wXs, p->wYs, p->wXe, p->wYs, LINE_COLOR);
+	}
+}
+
+static void record(DisplayList_t *pDl,DlCmd_t *pBuf)
+{
+	//Bo cuc nhu man hinh ket qua trong main.c, them 1 truong de len duong ke
+	dlInit(pDl, pBuf, 16, FC, BC);
+	dlRecordClear(pDl, 0, 155, 240, 320);
+	dlRecordText(pDl, 10, 155, "MAC ", 16);
+	dlRecordField(pDl, 42, 155, 0, 16);
+	dlRecordText(pDl, 10, 175, "Button     :", 16);
+	dlRecordField(pDl, 106, 175, 1, 16);
+	dlRecordHLine(pDl, 10, 230, 190);
+	dlRecordText(pDl, 10, 195, "Small      :", 12);
+	dlRecordField(pDl, 106, 195, 2, 12);
+	dlRecordHLine(pDl, 10, 230, 235);
+	//Ngoai vung CLEAR: ghep rieng theo khung cua lenh
+	dlRecordText(pDl, 4, 20, "Header", 16);
+	dlRecordHLine(pDl, 0, 239, 40);
+}
+
+static void check(const char *pcName,DisplayList_t *pDl,const char * const *ppValue)
+{
+	int iSame;
+
+	refRender(pDl, ppValue);
+	iSame = !memcmp(pwFb, pwRef, sizeof(pwFb));
+	printf("%-26s windows %3u  bytes %6u%s\n", pcName, dwWinCnt, dwBytes, iSame ? "" : "  MISMATCH");
+	if(!iSame) iFail++;
+	dwWinCnt = 0;
+	dwBytes = 0;
+}
+
+int main(void)
+{
+	static DlCmd_t pCmd[16];
+	DisplayList_t dl;
+	const char *pValue[FIELD_CNT];
+
+	srand(1);
+	for(int i = 0; i < 95; i++)
+	{
+		for(int r = 0; r < 12; r++) asc2_1206[i][r] = rand() & 0x3F;
+		for(int r = 0; r < 16; r++) asc2_1608[i][r] = rand() & 0xFF;
+	}
+	for(int y = 0; y < LCD_H; y++)
+		for(int x = 0; x < LCD_W; x++)
+			pwFb[y][x] = pwRef[y][x] = GARBAGE;
+
+	record(&dl, pCmd);
+	pValue[0] = "0123456789ABCDEF";
+	pValue[1] = "PASS";
+	pValue[2] = "1.2.3";
+	pValue[3] = NULL;
+	dlReplay(&dl, pValue);
+	check("full repaint", &dl, pValue);
+
+	dlReplay(&dl, pValue);
+	if(dwWinCnt != 0 || dwBytes != 0) iFail++;
+	check("same values", &dl, pValue);
+
+	pValue[0] = "0123456789ABCDEE";
+	dlReplay(&dl, pValue);
+	check("MAC last digit", &dl, pValue);
+
+	pValue[1] = "NG";
+	dlReplay(&dl, pValue);
+	check("button shorter", &dl, pValue);
+
+	pValue[1] = "TIMEOUT";
+	pValue[2] = NULL;
+	dlReplay(&dl, pValue);
+	check("button longer, NULL", &dl, pValue);
+
+	//Truong dai chay qua mep phai man hinh
+	pValue[0] = "FFFFFFFFFFFFFFFFFFFFFFFF";
+	dlReplay(&dl, pValue);
+	check("clipped at screen edge", &dl, pValue);
+
+	//Truong de len duong ke 190: phan ve lai phai giu duong ke
+	dlRecordField(&dl, 150, 180, 3, 16);
+	pValue[3] = "AB";
+	dlReplay(&dl, pValue);
+	check("re-record, overlap", &dl, pValue);
+	pValue[3] = "XY";
+	dlReplay(&dl, pValue);
+	check("overlap keeps line", &dl, pValue);
+
+	dlInvalidate(&dl);
+	dlReplay(&dl, pValue);
+	check("invalidate", &dl, pValue);
+
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
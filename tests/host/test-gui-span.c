@@ -0,0 +1,200 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-gui-span.c
+ *
+ * Description: Kiem tra va do so giao dich SPI cua gui-span tren LCD gia lap: so sanh
+ *              diem anh voi cach ve tung diem va dem cua so/lan ghi.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd-seq.h"
+#include "gui-span.h"
+
+// Duong cu: LCD_DrawPoint = LCD_SetWindows (2 lenh + 8 byte tham so + lenh
+// ghi RAM, moi byte 1 lan CS) + 1 lan ghi diem
+#define OLD_TRANS_PER_PIXEL		12
+// Duong moi: CASET, PASET, RAMWR moi lenh 1 lan CS + 1 lan ghi lien tuc
+#define NEW_TRANS_PER_FILL		4
+
+static uint8_t pbyFb[LCD_H][LCD_W];
+static uint8_t pbyRef[LCD_H][LCD_W];
+static uint32_t dwFillCnt;
+static int iFail;
+
+void LCD_SeqFill(u16 wXs,u16 wYs,u16 wXe,u16 wYe,u16 wColor)
+{
+	(void)wColor;
+	dwFillCnt++;
+	for(u16 y = wYs; y <= wYe && y < LCD_H; y++)
+		for(u16 x = wXs; x <= wXe && x < LCD_W; x++)
+			pbyFb[y][x] = 1;
+}
+
+static void refPoint(int x,int y)
+{
+	if(x >= 0 && y >= 0 && x < LCD_W && y < LCD_H)
+		pbyRef[y][x] = 1;
+}
+
+static void refLine(int x0,int y0,int x1,int y1)
+{
+	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+	int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+	int err = dx + dy, e2;
+
+	while(1)
+	{
+		refPoint(x0, y0);
+		if(x0 == x1 && y0 == y1) break;
+		e2 = 2*err;
+		if(e2 >= dy){ err += dy; x0 += sx; }
+		if(e2 <= dx){ err += dx; y0 += sy; }
+	}
+}
+
+static void refCircle(int xc,int yc,int r)
+{
+	int f = 1 - r, ddx = 1, ddy = -2*r, x = 0, y = r;
+
+	refPoint(xc, yc + r); refPoint(xc, yc - r);
+	refPoint(xc + r, yc); refPoint(xc - r, yc);
+	while(x < y)
+	{
+		if(f >= 0){ y--; ddy += 2; f += ddy; }
+		x++; ddx += 2; f += ddx;
+		refPoint(xc + x, yc + y); refPoint(xc - x, yc + y);
+		refPoint(xc + x, yc - y); refPoint(xc - x, yc - y);
+		refPoint(xc + y, yc + x); refPoint(xc - y, yc + x);
+		refPoint(xc + y, yc - x); refPoint(xc - y, yc - x);
+	}
+}
+
+static uint32_t countPixels(uint8_t (*p)[LCD_W])
+{
+	uint32_t n = 0;
+	for(int y = 0; y < LCD_H; y++)
+		for(int x = 0; x < LCD_W; x++)
+			n += p[y][x];
+	return n;
+}
+
+static void begin(void)
+{
+	memset(pbyFb, 0, sizeof(pbyFb));
+	memset(pbyRef, 0, sizeof(pbyRef));
+	dwFillCnt = 0;
+}
+
+// dwOld = 0: duong cu ve tung diem; khac 0: so giao dich cua duong cu
+static void reportOld(const char *pcName,int iSame,uint32_t dwOld)
+{
+	uint32_t dwPix = countPixels(pbyFb);
+	uint32_t dwNew = dwFillCnt*NEW_TRANS_PER_FILL;
+
+	if(dwOld == 0) dwOld = dwPix*OLD_TRANS_PER_PIXEL;
+	printf("%-22s px %6u  fills %5u  SPI trans %7u -> %5u (%5.1fx)%s\n", pcName,
+	       dwPix, dwFillCnt, dwOld, dwNew, dwNew ? (double)dwOld/dwNew : 0.0,
+	       iSame ? "" : "  MISMATCH");
+	if(!iSame) iFail++;
+}
+
+static void report(const char *pcName,int iSame)
+{
+	reportOld(pcName, iSame, 0);
+}
+
+// Moi hang to dung 1 doan lien tuc va trung bien voi hinh tham chieu
+static int rowsMatchOutline(void)
+{
+	for(int y = 0; y < LCD_H; y++)
+	{
+		int a = -1, b = -1, ra = -1, rb = -1, gaps = 0;
+		for(int x = 0; x < LCD_W; x++)
+		{
+			if(pbyFb[y][x]){ if(a < 0) a = x; else if(!pbyFb[y][x-1]) gaps++; b = x; }
+			if(pbyRef[y][x]){ if(ra < 0) ra = x; rb = x; }
+		}
+		if(gaps || a != ra || b != rb) return 0;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	static const int pLine[][4] = {
+		{10,190,230,190}, {120,20,120,300}, {0,0,239,319}, {5,300,200,10},
+		{10,10,230,40}, {200,50,20,60}, {30,30,31,300},
+	};
+	char pcName[32];
+
+	for(unsigned i = 0; i < sizeof(pLine)/sizeof(pLine[0]); i++)
+	{
+		begin();
+		guiSpanLine(pLine[i][0], pLine[i][1], pLine[i][2], pLine[i][3], WHITE);
+		refLine(pLine[i][0], pLine[i][1], pLine[i][2], pLine[i][3]);
+		snprintf(pcName, sizeof(pcName), "line %d,%d-%d,%d", pLine[i][0], pLine[i][1], pLine[i][2], pLine[i][3]);
+		report(pcName, !memcmp(pbyFb, pbyRef, sizeof(pbyFb)));
+	}
+
+	begin();
+	guiSpanRect(10, 20, 229, 300, WHITE);
+	refLine(10,20,229,20); refLine(10,300,229,300); refLine(10,20,10,300); refLine(229,20,229,300);
+	report("rect", !memcmp(pbyFb, pbyRef, sizeof(pbyFb)));
+
+	begin();
+	guiSpanFillRect(0, 25, 239, 319, WHITE);
+	for(int y = 25; y < 320; y++) refLine(0, y, 239, y);
+	//LCD_Fill cu: 1 cua so (11) + moi diem 1 lan ghi
+	reportOld("fill rect", !memcmp(pbyFb, pbyRef, sizeof(pbyFb)), 11 + 240*295);
+
+	for(int r = 1; r <= 100; r += 33)
+	{
+		begin();
+		guiSpanCircle(120, 160, r, WHITE);
+		refCircle(120, 160, r);
+		snprintf(pcName, sizeof(pcName), "circle r=%d", r);
+		report(pcName, !memcmp(pbyFb, pbyRef, sizeof(pbyFb)));
+
+		begin();
+		guiSpanFillCircle(120, 160, r, WHITE);
+		refCircle(120, 160, r);
+		snprintf(pcName, sizeof(pcName), "fill circle r=%d", r);
+		report(pcName, rowsMatchOutline());
+	}
+
+	begin();
+	guiSpanTriangle(20, 30, 220, 100, 90, 300, WHITE);
+	refLine(20,30,220,100); refLine(220,100,90,300); refLine(90,300,20,30);
+	report("triangle", !memcmp(pbyFb, pbyRef, sizeof(pbyFb)));
+
+	begin();
+	guiSpanFillTriangle(20, 30, 220, 100, 90, 300, WHITE);
+	{
+		int iOk = (dwFillCnt == 300 - 30 + 1) && pbyFb[30][20] && pbyFb[100][220] && pbyFb[300][90];
+		report("fill triangle", iOk);
+	}
+
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
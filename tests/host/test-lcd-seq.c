@@ -0,0 +1,274 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-lcd-seq.c
+ *
+ * Description: Chay lcd-seq.c (va display-list/gui-span ve qua no) tren ILI9341 gia
+ *                            lap o muc byte SPI: so khung hinh voi mo hinh tham chieu va anh
+ *                            golden (CRC, anh PPM trong build/), dem byte va thoi gian tren day.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lcd-seq.h"
+#include "display-list.h"
+#include "stm32f401re_spi.h"
+#include "ili9341-emu.h"
+
+#define GARBAGE					0x1234
+#define SPI_HZ					42000000	//SCK toi da cua SPI1 (APB2/2)
+#define BMP_W					240
+#define BMP_H					320
+
+typedef struct {
+	const char	*pcName;
+	uint32_t	dwCrc;
+}Golden_t;
+
+// Cap nhat khi thay doi co chu dich: chay test, xem build/<ten>.ppm, chep CRC moi
+static const Golden_t pGolden[] = {
+	{"fills",			0xD960F3E9},
+	{"bmp",				0x2A3D8720},
+	{"result-screen",	0x40A4A3FD},
+	{"result-update",	0x63938F4A},
+	{"landscape",		0x0565B1EF},
+};
+
+// Trong GUI.c la bang const; o day dien ngau nhien luc chay
+unsigned char asc2_1206[95][12];
+unsigned char asc2_1608[95][16];
+
+static u16 pwRef[LCD_H][LCD_W];
+static u8 pbyBmp[BMP_W*BMP_H*2];
+static int iFail;
+
+static void expect(int iOk,const char *pcWhat,unsigned i)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (%u)\n", pcWhat, i);
+		iFail++;
+	}
+}
+
+static void refFill(int xs,int ys,int xe,int ye,u16 c)
+{
+	for(int y = ys; y <= ye; y++)
+		for(int x = xs; x <= xe; x++)
+			pwRef[y][x] = c;
+}
+
+// So GRAM (toa do logic) voi pwRef; tra ve so diem sai
+static unsigned diffRef(void)
+{
+	unsigned n = 0;
+
+	for(int y = 0; y < LCD_H; y++)
+		for(int x = 0; x < LCD_W; x++)
+			n += ili9341EmuPixel(x, y) != pwRef[y][x];
+	return n;
+}
+
+// In byte tren day, luu PPM, so CRC golden; khong co loi giao thuc
+static void scene(const char *pcName)
+{
+	char pcPath[64];
+	uint32_t dwCrc = ili9341EmuCrc();
+	const Ili9341EmuStats_t *p = &g_ili9341EmuStats;
+
+	snprintf(pcPath, sizeof(pcPath), "build/%s.ppm", pcName);
+	ili9341EmuSavePpm(pcPath);
+	printf("%-14s cmd %4u param %5u pixel %7u  CS %4u  win %4u  %6u us @42MHz  crc %08X\n",
+	       pcName, p->dwCmdBytes, p->dwParamBytes, p->dwPixelBytes, p->dwCsCycles,
+	       p->dwWinCmds, ili9341EmuWireUs(SPI_HZ), dwCrc);
+	if(p->dwErrors != 0)
+		printf("  first error: %s\n", p->pcFirstError);
+	expect(p->dwErrors == 0, "protocol errors", p->dwErrors);
+	for(unsigned i = 0; i < sizeof(pGolden)/sizeof(pGolden[0]); i++)
+	{
+		if(strcmp(pGolden[i].pcName, pcName) == 0 && pGolden[i].dwCrc != dwCrc)
+		{
+			printf("FAIL golden %s: %08X, expected %08X (see %s)\n", pcName, dwCrc, pGolden[i].dwCrc, pcPath);
+			iFail++;
+		}
+	}
+	ili9341EmuStatsClear();
+}
+
+static void testInit(void)
+{
+	ili9341EmuReset(GARBAGE);
+	g_iHostPowerOnReset = 1;
+	expect(LCD_SeqInit() == 0, "cold init", 0);
+	expect(g_byIli9341Madctl == 0x08, "MADCTL portrait BGR", g_byIli9341Madctl);
+	expect(g_pdwIli9341CmdCnt[0x3A] == 1 && g_pdwIli9341CmdCnt[0xCF] == 1, "full table sent", 0);
+	expect(g_pdwIli9341CmdCnt[0x11] == 1 && g_pdwIli9341CmdCnt[0x29] == 1, "sleep out, display on", 0);
+	expect(g_pdwIli9341CmdCnt[0x2C] == 0, "init writes no GRAM", 0);
+	expect(g_ili9341EmuStats.dwErrors == 0, "init protocol errors", g_ili9341EmuStats.dwErrors);
+
+	ili9341EmuReset(GARBAGE);
+	g_iHostPowerOnReset = 0;
+	expect(LCD_SeqInit() == 1, "warm init", 0);
+	expect(g_pdwIli9341CmdCnt[0xCF] == 0 && g_pdwIli9341CmdCnt[0x29] == 1, "warm table only", 0);
+	expect(g_byIli9341Madctl == 0x08, "warm MADCTL", g_byIli9341Madctl);
+	ili9341EmuStatsClear();
+}
+
+static void testFills(void)
+{
+	//Nen toan man hinh (DMA, nhieu khoi), hinh nho < 32 diem (gui tung byte),
+	//nguong 31/32 diem, hai vung chung cot va chung hang (bo qua CASET/PASET)
+	static const u16 pwRect[][5] = {
+		{  0,   0, 239, 319, WHITE},
+		{  5,   5,   7,   7, BLUE},
+		{ 10,  20,  40,  20, GREEN},
+		{ 10,  22,  41,  22, RED},
+		{100,  50, 139, 299, CYAN},
+		{  0,  50,  50, 299, RED},
+		{  0,  10,  50,  20, BLACK},
+		{239, 319, 239, 319, BLUE},
+	};
+	int iCnt = sizeof(pwRect)/sizeof(pwRect[0]);
+
+	for(int i = 0; i < iCnt; i++)
+	{
+		LCD_SeqFill(pwRect[i][0], pwRect[i][1], pwRect[i][2], pwRect[i][3], pwRect[i][4]);
+		refFill(pwRect[i][0], pwRect[i][1], pwRect[i][2], pwRect[i][3], pwRect[i][4]);
+	}
+	expect(diffRef() == 0, "fills match reference", diffRef());
+	expect(g_ili9341EmuStats.dwWinCmds == (unsigned)2*iCnt - 2, "cached window skips CASET/PASET",
+	       g_ili9341EmuStats.dwWinCmds);
+	scene("fills");
+}
+
+static void testBmp(void)
+{
+	u16 w;
+
+	//Anh RGB565 byte thap truoc nhu gImage_logo
+	for(int y = 0; y < BMP_H; y++)
+		for(int x = 0; x < BMP_W; x++)
+		{
+			w = (u16)((x*0x0841) ^ (y*0x1003) ^ (x*y));
+			pbyBmp[2*(y*BMP_W + x)] = w;
+			pbyBmp[2*(y*BMP_W + x) + 1] = w >> 8;
+		}
+	LCD_SeqDrawBmp16(0, 0, BMP_W, BMP_H, pbyBmp);
+	for(int y = 0; y < BMP_H; y++)
+		for(int x = 0; x < BMP_W; x++)
+			pwRef[y][x] = pbyBmp[2*(y*BMP_W + x)] | pbyBmp[2*(y*BMP_W + x) + 1] << 8;
+	//Anh nho lech goc: dong ngan hon cua so truoc
+	LCD_SeqDrawBmp16(50, 60, 100, 80, pbyBmp);
+	for(int y = 0; y < 80; y++)
+		for(int x = 0; x < 100; x++)
+			pwRef[60 + y][50 + x] = pbyBmp[2*(y*100 + x)] | pbyBmp[2*(y*100 + x) + 1] << 8;
+	expect(diffRef() == 0, "bmp matches reference", diffRef());
+	scene("bmp");
+}
+
+static void record(DisplayList_t *pDl,DlCmd_t *pBuf)
+{
+	//Bo cuc nhu man hinh ket qua trong main.c
+	dlInit(pDl, pBuf, 16, BLACK, WHITE);
+	dlRecordClear(pDl, 0, 155, 240, 320);
+	dlRecordText(pDl, 10, 155, "MAC ", 16);
+	dlRecordField(pDl, 42, 155, 0, 16);
+	dlRecordText(pDl, 10, 175, "Button     :", 16);
+	dlRecordField(pDl, 106, 175, 1, 16);
+	dlRecordHLine(pDl, 10, 230, 190);
+	dlRecordText(pDl, 10, 195, "Ver        :", 12);
+	dlRecordField(pDl, 106, 195, 2, 12);
+	dlRecordText(pDl, 4, 20, "Header", 16);
+	dlRecordHLine(pDl, 0, 239, 40);
+}
+
+static void testDisplayList(void)
+{
+	static DlCmd_t pCmd[16];
+	DisplayList_t dl;
+	const char *pValue[3] = {"0123456789ABCDEF", "PASS", "01.02.03"};
+	uint32_t dwUpdated;
+
+	LCD_SeqInvalidate();
+	LCD_SeqFill(0, 0, LCD_W - 1, LCD_H - 1, WHITE);
+	ili9341EmuStatsClear();
+	record(&dl, pCmd);
+	dlReplay(&dl, pValue);
+	scene("result-screen");
+
+	//Cap nhat tung phan phai cho cung anh voi ve lai toan bo
+	pValue[0] = "0123456789ABCDEE";
+	pValue[1] = "NG";
+	dlReplay(&dl, pValue);
+	dwUpdated = ili9341EmuCrc();
+	expect(g_ili9341EmuStats.dwPixelBytes < 4096, "incremental update is small", g_ili9341EmuStats.dwPixelBytes);
+	scene("result-update");
+
+	LCD_SeqFill(0, 0, LCD_W - 1, LCD_H - 1, WHITE);
+	dlInvalidate(&dl);
+	dlReplay(&dl, pValue);
+	expect(ili9341EmuCrc() == dwUpdated, "update equals full repaint", 0);
+	ili9341EmuStatsClear();
+}
+
+static void testLandscape(void)
+{
+	LCD_direction(1);
+	LCD_SeqInvalidate();
+	LCD_SeqFill(0, 0, LCD_H - 1, LCD_W - 1, BLACK);
+	LCD_SeqFill(0, 0, LCD_H - 1, 9, RED);
+	LCD_SeqFill(0, 0, 9, LCD_W - 1, GREEN);
+	expect(ili9341EmuPixel(5, 5) == GREEN && ili9341EmuPixel(300, 5) == RED, "landscape strips", 0);
+	expect(ili9341EmuPixel(300, 200) == BLACK && ili9341EmuPixel(319, 239) == BLACK, "landscape fill", 0);
+	scene("landscape");
+	LCD_direction(USE_HORIZONTAL);
+	LCD_SeqInvalidate();
+	ili9341EmuStatsClear();
+}
+
+int main(void)
+{
+	srand(1);
+	for(int i = 0; i < 95; i++)
+	{
+		for(int r = 0; r < 12; r++) asc2_1206[i][r] = rand() & 0x3F;
+		for(int r = 0; r < 16; r++) asc2_1608[i][r] = rand() & 0xFF;
+	}
+
+	testInit();
+	testFills();
+	testBmp();
+	testDisplayList();
+	testLandscape();
+
+	//Bo kiem tra cua gia lap: doi RS khi byte con trong SPI phai bi bat
+	LCD_CS_CLR;
+	SPI1->DR = 0x00;
+	LCD_RS_CLR;
+	expect(g_ili9341EmuStats.dwErrors == 1, "emulator flags early RS change", g_ili9341EmuStats.dwErrors);
+	(void)SPI1->SR;
+	LCD_RS_SET;
+	LCD_CS_SET;
+
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
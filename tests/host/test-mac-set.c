@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-mac-set.c
+ *
+ * Description: Kiem tra va do thoi gian tra cuu cua mac-set: MAC lien tiep nhu tren
+ *              day chuyen (6 byte thap), tra cuu trung/truot o do day 25/50/75%.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <time.h>
+#include "mac-set.h"
+
+#define MAC_LOW48(mac)			((mac) & 0xFFFFFFFFFFFFULL)
+#define MAC_BASE				0x000D6FFFFE000000ULL	//EUI-64 ZigBee, cung lo
+#define LOOKUPS					2000000
+
+static int iFail;
+static volatile uint32_t dwSink;
+
+static void expect(int iOk,const char *pcWhat,unsigned i)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (%u)\n", pcWhat, i);
+		iFail++;
+	}
+}
+
+static double nowNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+// Thoi gian 1 lan tra cuu (ns): trung lay trong [0, wCount), truot lay ngoai
+static double timeLookup(uint16_t wCount,int iHit)
+{
+	uint32_t dwHits = 0;
+	double t0 = nowNs();
+
+	for(uint32_t i = 0; i < LOOKUPS; i++)
+	{
+		uint32_t k = iHit ? (i*2654435761u) % wCount : wCount + 100000 + i;
+		dwHits += macSetContains(MAC_LOW48(MAC_BASE + k));
+	}
+	dwSink = dwHits;
+	expect(dwHits == (iHit ? LOOKUPS : 0), iHit ? "lookup hits" : "lookup misses", wCount);
+	return (nowNs() - t0)/LOOKUPS;
+}
+
+int main(void)
+{
+	uint16_t wFill[3] = { MAC_SET_SIZE/4, MAC_SET_SIZE/2, MAC_SET_MAX_FILL };
+	uint16_t wAt = 0;
+	uint64_t qwBle;
+
+	macSetClear();
+	for(int f = 0; f < 3; f++)
+	{
+		for(; wAt < wFill[f]; wAt++)
+			expect(macSetInsert(MAC_LOW48(MAC_BASE + wAt)) == MAC_SET_ADDED, "insert", wAt);
+		printf("fill %2d%% (%4u MACs): hit %5.1f ns  miss %5.1f ns\n",
+		       wFill[f]*100/MAC_SET_SIZE, wAt, timeLookup(wAt, 1), timeLookup(wAt, 0));
+	}
+	expect(macSetCount() == MAC_SET_MAX_FILL, "count", macSetCount());
+	expect(macSetInsert(MAC_LOW48(MAC_BASE + wAt)) == MAC_SET_FULL, "full at max fill", wAt);
+	expect(macSetInsert(MAC_LOW48(MAC_BASE)) == MAC_SET_EXISTS, "exists when full", 0);
+
+	//MAC BLE cua cung DUT chi khac 2 byte cao: tim theo 6 byte thap phai trung
+	qwBle = 0xC0FF000000000000ULL | MAC_LOW48(MAC_BASE + 7);
+	expect(macSetContains(MAC_LOW48(qwBle)), "BLE MAC matches ZigBee entry", 7);
+	expect(!macSetContains(qwBle), "full 64-bit key differs", 7);
+	expect(!macSetContains(0), "MAC 0 never present", 0);
+
+	macSetClear();
+	expect(macSetCount() == 0 && !macSetContains(MAC_LOW48(MAC_BASE)), "clear", 0);
+
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
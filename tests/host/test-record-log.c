@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-record-log.c
+ *
+ * Description: Kiem tra record-log tren flash RAM gia lap: cat dien o moi thao tac
+ *              xoa/ghi (ban ghi ghi do, header/the he ghi do, xoa sector do), dung lai
+ *              chi muc sau reset va kiem tra khong mat ban ghi da ghi xong. Chay ca
+ *              khi co va khong co xoa san sector (recordLogPrepare).
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ram-flash.h"
+#include "record-log.h"
+
+// Header 16 byte + 8 o 48 byte moi sector
+#define SLOTS					8u
+#define SECTOR_SIZE				(16 + SLOTS*48)
+#define APPEND_CNT				30
+// Ban ghi 12 word, header 4 word
+#define RECORD_OPS				(48u/4)
+#define HEADER_OPS				(16u/4)
+// recordLogPrepare xoa san khi con <= PREPARE_SPARE o trong
+#define PREPARE_SPARE			2
+
+static FlashDev_t dev;
+static volatile uint32_t dwDone;
+static int iFail;
+static uint16_t wSpare;		//0: khong xoa san, khac 0: goi recordLogPrepare truoc moi lan ghi
+
+static void payloadOf(uint32_t dwId,uint8_t *pbyPayload)
+{
+	memcpy(pbyPayload, &dwId, 4);
+	for(int i = 4; i < LOG_PAYLOAD_SIZE; i++) pbyPayload[i] = (uint8_t)(dwId*31 + i);
+}
+
+static void expect(int iOk,const char *pcWhat,int iCut,int i)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (cut %d, %d)\n", pcWhat, iCut, i);
+		iFail++;
+	}
+}
+
+static void runScript(void)
+{
+	RecordLog_t log;
+	uint8_t pbyPayload[LOG_PAYLOAD_SIZE];
+
+	recordLogInit(&log, &dev);
+	for(uint32_t i = 1; i <= APPEND_CNT; i++)
+	{
+		uint32_t dwOps;
+
+		if(wSpare && recordLogPrepare(&log, wSpare) != 0) return;
+		payloadOf(i, pbyPayload);
+		dwOps = g_ramFlashOps;
+		if(recordLogAppend(&log, pbyPayload) != 0) return;
+		dwDone = i;
+		//Da xoa san: doi sector chi ghi header, khong xoa trong luc ghi ket qua
+		if(wSpare)
+		{
+			expect(g_ramFlashOps - dwOps == RECORD_OPS + (log.wNextSlot == 1 ? HEADER_OPS : 0),
+			       "append after prepare never erases", -1, i);
+		}
+	}
+}
+
+// Doc het nhat ky: ban ghi hop le tang dan, ban moi nhat la ban ghi xong
+// cuoi cung va it nhat 1 sector ban ghi gan nhat con nguyen
+static uint32_t checkLog(RecordLog_t *pLog,uint32_t dwLast,int iCut)
+{
+	uint8_t pbyPayload[LOG_PAYLOAD_SIZE], pbyWant[LOG_PAYLOAD_SIZE];
+	uint32_t dwId, dwPrev = 0, dwTail = 0, dwValid = 0;
+
+	for(uint32_t i = 0; i < recordLogCount(pLog); i++)
+	{
+		if(!recordLogRead(pLog, i, pbyPayload)) continue;
+		memcpy(&dwId, pbyPayload, 4);
+		payloadOf(dwId, pbyWant);
+		expect(!memcmp(pbyPayload, pbyWant, LOG_PAYLOAD_SIZE), "payload intact", iCut, dwId);
+		expect(dwId > dwPrev, "records in order", iCut, dwId);
+		dwTail = (dwId == dwPrev + 1) ? dwTail + 1 : 1;
+		dwPrev = dwId;
+		dwValid++;
+	}
+	expect(dwPrev == dwLast, "newest record is the last committed", iCut, dwPrev);
+	expect(dwTail >= (dwLast < SLOTS - wSpare ? dwLast : SLOTS - wSpare), "last sector of records kept", iCut, dwTail);
+	return dwValid;
+}
+
+static void checkAfterReset(int iCut)
+{
+	RecordLog_t log, live;
+	uint8_t pbyPayload[LOG_PAYLOAD_SIZE];
+
+	recordLogInit(&log, &dev);
+	checkLog(&log, dwDone, iCut);
+
+	//Ghi tiep sau reset; chi muc dung lai phai trung chi muc dang chay
+	for(uint32_t j = 1; j <= 2*SLOTS + 3; j++)
+	{
+		payloadOf(1000 + j, pbyPayload);
+		expect(recordLogAppend(&log, pbyPayload) == 0, "append after reset", iCut, j);
+		live = log;
+		recordLogInit(&log, &dev);
+		expect(log.dwGen == live.dwGen && log.byActive == live.byActive &&
+		       log.wNextSlot == live.wNextSlot && log.byUsed == live.byUsed,
+		       "index rebuilt after reset", iCut, j);
+		expect(recordLogRead(&log, recordLogCount(&log) - 1, pbyPayload) &&
+		       !memcmp(pbyPayload, &(uint32_t){1000 + j}, 4), "newest after reset", iCut, j);
+	}
+	checkLog(&log, 1000 + 2*SLOTS + 3, iCut);
+}
+
+int main(void)
+{
+	//Giu qua longjmp
+	static uint32_t dwOps, n;
+	static int iCuts, iPrepare, iSeed;
+
+	for(iPrepare = 0; iPrepare < 2; iPrepare++)
+	{
+		wSpare = iPrepare ? PREPARE_SPARE : 0;
+		ramFlashInit(&dev, SECTOR_SIZE);
+		dwDone = 0;
+		runScript();
+		dwOps = g_ramFlashOps;
+		expect(dwDone == APPEND_CNT, "uninterrupted script", -1, dwDone);
+		checkAfterReset(-1);
+
+		for(iSeed = 0; iSeed < 8; iSeed++)
+		{
+			for(n = 0; n < dwOps; n++)
+			{
+				srand(n*13 + iSeed);
+				ramFlashInit(&dev, SECTOR_SIZE);
+				dwDone = 0;
+				if(setjmp(g_ramFlashReset) == 0)
+				{
+					ramFlashCutAt(n);
+					runScript();
+				}
+				ramFlashCutAt(RAM_FLASH_NO_CUT);
+				checkAfterReset(n);
+				iCuts++;
+			}
+		}
+		printf("%s: %u flash ops per script\n", iPrepare ? "prepare" : "no prepare", dwOps);
+	}
+	printf("%d power cuts replayed\n", iCuts);
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
@@ -0,0 +1,559 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-result-pane.c
+ *
+ * Description: 2 luong byte DUT gia lap (moi kenh 1 luong) qua uart-channel va
+ *              dut-session, ket qua ve vao 2 o cua result-pane tren ILI9341
+ *              gia lap. Moi o phai co ma QR, MAC va ket qua cua chinh kenh do,
+ *              khong ve de len o kia; ve lai tung phan phai giong ve lai ca o.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "qrcode.h"
+#include "lcd-seq.h"
+#include "scratch-arena.h"
+#include "uart-channel.h"
+#include "dut-session.h"
+#include "result-pane.h"
+#include "stm32f401re_rcc.h"
+#include "ili9341-emu.h"
+
+#define SPI_HZ					42000000
+#define SIM_CH_CNT				2
+#define SIM_DUT_MAX				4
+#define SIM_STREAM_MAX			(SIM_DUT_MAX * 3 * 3 * 48)
+#define SIM_DWELL_CYCLES		3
+#define SIM_MAC_BASE			0x00124B0000A10000ULL
+
+// Vi tri trong o, giong RP_xxx cua result-pane.c
+#define PANE_STATUS_X			52
+#define PANE_STATUS_Y			2
+#define PANE_BOX_X				228
+#define PANE_BOX_Y				9
+#define PANE_MAC_X				36
+#define PANE_MAC_MIN_Y			114
+#define PANE_MODEL_DY			17
+#define PANE_FAIL_MSG_Y			24
+#define PANE_FAIL_MAC_Y			44
+
+typedef enum {
+	DUT_OK,
+	DUT_BLE_MISMATCH,
+	DUT_ZIGBEE_MISMATCH,
+	DUT_BOTH_MISMATCH
+}DutKind_e;
+
+typedef struct {
+	uint8_t		byDut;				//MAC = SIM_MAC_BASE + byDut
+	uint8_t		byEndpointCnt;
+	uint8_t		byKind;
+}SimDut_t;
+
+typedef struct {
+	uint8_t			pbyStream[SIM_STREAM_MAX];
+	uint16_t		wLen;
+	uint16_t		wPos;
+	UartChannel_t	uartCh;
+	DutSession_t	sess;
+	ResultPane_t	pane;
+	uint8_t			byLayout;			//0: chua ve, 1+event: bo cuc dang ve
+	TestSwMode_e	layoutMode;
+	uint8_t			byEvents;
+}SimChannel_t;
+
+// Trong GUI.c la bang const; o day dien ngau nhien luc chay
+unsigned char asc2_1206[95][12];
+unsigned char asc2_1608[95][16];
+
+static SimChannel_t g_pSimCh[SIM_CH_CNT];
+static TestSwMode_e g_mode;
+static int iFail;
+
+static void expect(int iOk,const char *pcWhat,unsigned i)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (%u)\n", pcWhat, i);
+		iFail++;
+	}
+}
+
+/******************************************************************************/
+/*               Bo ma hoa QR gia: module la bam cua chuoi                     */
+/******************************************************************************/
+uint16_t qrcode_getBufferSize(uint8_t version)
+{
+	uint16_t wSize = 17 + 4 * version;
+
+	return (wSize * wSize + 7) / 8;
+}
+
+int8_t qrcode_initText(QRCode *qrcode,uint8_t *modules,uint8_t version,uint8_t ecc,const char *data)
+{
+	uint32_t dwHash = 2166136261u;
+	uint16_t wBits;
+
+	qrcode->version = version;
+	qrcode->ecc = ecc;
+	qrcode->size = 17 + 4 * version;
+	qrcode->modules = modules;
+	wBits = qrcode->size * qrcode->size;
+	for(const char *pc = data; *pc; pc++)
+	{
+		dwHash = (dwHash ^ (uint8_t)*pc) * 16777619u;
+	}
+	memset(modules, 0, qrcode_getBufferSize(version));
+	for(uint16_t i = 0; i < wBits; i++)
+	{
+		dwHash ^= dwHash << 13;
+		dwHash ^= dwHash >> 17;
+		dwHash ^= dwHash << 5;
+		if(dwHash & 1)
+		{
+			modules[i >> 3] |= 1 << (i & 7);
+		}
+	}
+	return 0;
+}
+
+bool qrcode_getModule(QRCode *qrcode,uint8_t x,uint8_t y)
+{
+	uint16_t i = y * qrcode->size + x;
+
+	return (qrcode->modules[i >> 3] >> (i & 7)) & 1;
+}
+
+/******************************************************************************/
+/*                          Kiem tra anh tren GRAM                            */
+/******************************************************************************/
+static uint32_t rowsHash(u16 wYs,u16 wYe)
+{
+	uint32_t dwHash = 2166136261u;
+
+	for(u16 y = wYs; y <= wYe; y++)
+		for(u16 x = 0; x < LCD_W; x++)
+			dwHash = (dwHash ^ ili9341EmuPixel(x, y)) * 16777619u;
+	return dwHash;
+}
+
+// Chu ve bang asc2_xxxx, bit thap la cot trai, chu den nen trang
+static int textMatches(u16 wX,u16 wY,const char *pcText,u8 bySize)
+{
+	for(; *pcText; pcText++, wX += bySize / 2)
+	{
+		for(u8 r = 0; r < bySize; r++)
+		{
+			u8 b = (bySize == 12) ? asc2_1206[*pcText - ' '][r] : asc2_1608[*pcText - ' '][r];
+
+			for(u8 t = 0; t < bySize / 2; t++, b >>= 1)
+				if(ili9341EmuPixel(wX + t, wY + r) != ((b & 1) ? BLACK : WHITE))
+					return 0;
+		}
+	}
+	return 1;
+}
+
+// Dong MAC: duoi ma QR va duoi 6 dong cua cot phai
+static u16 paneMacY(const ResultPane_t *pPane)
+{
+	u16 wQrEnd = RESULT_PANE_QR_Y + RESULT_PANE_QR_PX(pPane->byQrScale) + 2;
+
+	return (wQrEnd > PANE_MAC_MIN_Y) ? wQrEnd : PANE_MAC_MIN_Y;
+}
+
+// Vung QR cua o ve dung ma cua pcData (ke ca le trang)
+static int qrMatches(const ResultPane_t *pPane,const char *pcData)
+{
+	QRCode qrcode;
+	uint8_t pbyModules[256];
+	int iMx, iMy;
+	u16 wColor;
+	u8 byScale = pPane->byQrScale;
+	u16 wQrPx = RESULT_PANE_QR_PX(byScale);
+
+	qrcode_initText(&qrcode, pbyModules, RESULT_PANE_QR_VERSION, ECC_LOW, pcData);
+	for(u16 y = 0; y < wQrPx; y++)
+	{
+		iMy = y / byScale - RESULT_PANE_QR_QUIET;
+		for(u16 x = 0; x < wQrPx; x++)
+		{
+			iMx = x / byScale - RESULT_PANE_QR_QUIET;
+			wColor = WHITE;
+			if(iMx >= 0 && iMy >= 0 && iMx < qrcode.size && iMy < qrcode.size && qrcode_getModule(&qrcode, iMx, iMy))
+				wColor = BLACK;
+			if(ili9341EmuPixel(x, pPane->wY + RESULT_PANE_QR_Y + y) != wColor)
+				return 0;
+		}
+	}
+	return 1;
+}
+
+// Le trang quanh ma QR rong 4 module theo chuan, khong phu thuoc RESULT_PANE_QR_QUIET
+static int qrQuietZone(const ResultPane_t *pPane)
+{
+	u8 byScale = pPane->byQrScale;
+	u16 wQrPx = RESULT_PANE_QR_PX(byScale);
+	u16 wQuiet = 4 * byScale;
+	u16 wYs = pPane->wY + RESULT_PANE_QR_Y;
+
+	for(u16 y = 0; y < wQrPx; y++)
+		for(u16 x = 0; x < wQrPx; x++)
+			if((x < wQuiet || y < wQuiet || x >= wQrPx - wQuiet || y >= wQrPx - wQuiet) &&
+			   ili9341EmuPixel(x, wYs + y) != WHITE)
+				return 0;
+	return 1;
+}
+
+/******************************************************************************/
+/*                          Tao luong byte cua DUT                            */
+/******************************************************************************/
+static void simFrame(SimChannel_t *pSim,const void *pPayload,uint8_t byLen)
+{
+	const uint8_t *pby = pPayload;
+	uint8_t byXor = 0;
+
+	pSim->pbyStream[pSim->wLen++] = 0x4C;
+	pSim->pbyStream[pSim->wLen++] = 0x4D;
+	pSim->pbyStream[pSim->wLen++] = byLen + 1;
+	for(uint8_t i = 0; i < byLen; i++)
+	{
+		pSim->pbyStream[pSim->wLen++] = pby[i];
+		byXor ^= pby[i];
+	}
+	pSim->pbyStream[pSim->wLen++] = byXor;
+}
+
+static uint64_t simMac(uint8_t byDut,uint8_t byProtocol)
+{
+	uint64_t qwMAC = SIM_MAC_BASE + byDut;
+
+	//MAC BLE chi giong MAC ZigBee o 6 byte thap
+	return (byProtocol == PROTOCOL_TYPE_BLUETOOTH) ? (MAC_LOW48(qwMAC) | 0xFFFF000000000000ULL) : qwMAC;
+}
+
+static void simRadio(SimChannel_t *pSim,uint8_t byDut,uint8_t byProtocol,uint8_t byEndpointCnt)
+{
+	CmdData_t cmd;
+	uint64_t qwMAC = simMac(byDut, byProtocol);
+
+	memset(&cmd, 0, sizeof(cmd));
+	cmd.byCmdId = CMD_ID_ZIGBEE_AND_BLE;
+	cmd.protocolType = byProtocol;
+	cmd.deviceType = 0x01;
+	cmd.byEndpointCnt = byEndpointCnt;
+	cmd.provisonState = UN_PROVISION;
+	for(uint8_t i = 0; i < LENGTH_OF_MAC; i++)
+	{
+		cmd.pbyMAC[i] = (uint8_t)(qwMAC >> (56 - 8 * i));
+	}
+	cmd.pbyVersion[0] = 1;
+	cmd.pbyVersion[1] = byProtocol;
+	cmd.pbyVersion[2] = byDut;
+	if(byProtocol == PROTOCOL_TYPE_ZIGBEE)
+	{
+		cmd.pbyInFor[0] = 7;
+		memcpy(&cmd.pbyInFor[1], "SW3-ZB1", 7);
+	}else
+	{
+		cmd.pbyInFor[0] = 0x12;
+		cmd.pbyInFor[1] = 0x34;
+	}
+	simFrame(pSim, &cmd, sizeof(cmd));
+}
+
+static void simMcu(SimChannel_t *pSim,uint8_t byEndpointCnt)
+{
+	McuInfor_t mcu;
+
+	memset(&mcu, 0, sizeof(mcu));
+	mcu.cmd_id = CMD_ID_MCU_TOUCH;
+	mcu.version[0] = 2;
+	mcu.type = 0x01;
+	mcu.endpoint_cnt = byEndpointCnt;
+	simFrame(pSim, &mcu, sizeof(mcu));
+}
+
+static void simBuildStream(SimChannel_t *pSim,const SimDut_t *pDut,uint8_t byDuts)
+{
+	pSim->wLen = 0;
+	pSim->wPos = 0;
+	for(uint8_t k = 0; k < byDuts; k++)
+	{
+		for(uint8_t c = 0; c < SIM_DWELL_CYCLES; c++)
+		{
+			simMcu(pSim, pDut[k].byEndpointCnt);
+			simRadio(pSim, pDut[k].byDut, PROTOCOL_TYPE_ZIGBEE,
+					 pDut[k].byEndpointCnt + (pDut[k].byKind == DUT_ZIGBEE_MISMATCH || pDut[k].byKind == DUT_BOTH_MISMATCH));
+			simRadio(pSim, pDut[k].byDut, PROTOCOL_TYPE_BLUETOOTH,
+					 pDut[k].byEndpointCnt + (pDut[k].byKind == DUT_BLE_MISMATCH || pDut[k].byKind == DUT_BOTH_MISMATCH));
+		}
+	}
+}
+
+/******************************************************************************/
+/*              Phan xu ly su kien, giong dutSessionEvent cua main.c          */
+/******************************************************************************/
+static void simDraw(SimChannel_t *pSim,DutEvent_e event,const CmdData_t *pCmd)
+{
+	if(event == DUT_EVENT_PASS)
+	{
+		resultPaneShowPass(&pSim->pane, &pSim->sess, g_mode, pCmd->deviceType);
+	}else
+	{
+		resultPaneShowFail(&pSim->pane, &pSim->sess, g_mode, event);
+	}
+}
+
+// Chu ket qua o tieu de o
+static const char *eventName(DutEvent_e event)
+{
+	switch(event)
+	{
+	case DUT_EVENT_PASS:		return "PASS";
+	case DUT_EVENT_FAIL_BLE:	return "FAIL BLE";
+	case DUT_EVENT_FAIL_BOTH:	return "FAIL ZB+BLE";
+	default:					return "FAIL ZigBee";
+	}
+}
+
+static void simCheckPane(SimChannel_t *pSim,DutEvent_e event,uint8_t byDut)
+{
+	u16 wY = pSim->pane.wY;
+	uint64_t qwMAC = simMac(byDut, (g_mode == BLE_MODE) ? PROTOCOL_TYPE_BLUETOOTH : PROTOCOL_TYPE_ZIGBEE);
+	uint32_t dwVerZb = 0x010000 | (PROTOCOL_TYPE_ZIGBEE << 8) | byDut;
+	uint32_t dwVerBle = 0x010000 | (PROTOCOL_TYPE_BLUETOOTH << 8) | byDut;
+	char pcMAC[24];
+	char pcQr[RESULT_PANE_QR_DATA_SIZE];
+	const char *pcMsg;
+
+	snprintf(pcMAC, sizeof(pcMAC), "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
+			 (unsigned)(qwMAC >> 56) & 0xFF, (unsigned)(qwMAC >> 48) & 0xFF, (unsigned)(qwMAC >> 40) & 0xFF,
+			 (unsigned)(qwMAC >> 32) & 0xFF, (unsigned)(qwMAC >> 24) & 0xFF, (unsigned)(qwMAC >> 16) & 0xFF,
+			 (unsigned)(qwMAC >> 8) & 0xFF, (unsigned)qwMAC & 0xFF);
+	if(event == DUT_EVENT_PASS)
+	{
+		if(g_mode == DUAL_MODE)
+			snprintf(pcQr, sizeof(pcQr), "%016llX,01,1234,%06X,%06X", (unsigned long long)qwMAC, dwVerZb, dwVerBle);
+		else if(g_mode == ZIGBEE_MODE)
+			snprintf(pcQr, sizeof(pcQr), "%016llX,01,%06X", (unsigned long long)qwMAC, dwVerZb);
+		else
+			snprintf(pcQr, sizeof(pcQr), "%016llX,01,1234,%06X", (unsigned long long)qwMAC, dwVerBle);
+		expect(qrMatches(&pSim->pane, pcQr), "QR cua kenh", pSim->sess.byChannel);
+		expect(qrQuietZone(&pSim->pane), "le trang QR 4 module", pSim->sess.byChannel);
+		expect(textMatches(4, wY + paneMacY(&pSim->pane), "MAC ", 16), "nhan MAC", pSim->sess.byChannel);
+		expect(textMatches(PANE_MAC_X, wY + paneMacY(&pSim->pane), pcMAC, 16), "MAC cua kenh", pSim->sess.byChannel);
+		if(g_mode != BLE_MODE)
+		{
+			expect(textMatches(4, wY + paneMacY(&pSim->pane) + PANE_MODEL_DY, "Model ", 16), "nhan Model",
+				   pSim->sess.byChannel);
+		}
+		expect(textMatches(PANE_STATUS_X, wY + PANE_STATUS_Y, "PASS", 16), "chu PASS", pSim->sess.byChannel);
+		expect(ili9341EmuPixel(PANE_BOX_X, wY + PANE_BOX_Y) == GREEN, "o mau xanh", pSim->sess.byChannel);
+	}else
+	{
+		pcMsg = (g_mode != DUAL_MODE) ? "Firmware ERROR!!!" :
+				(event == DUT_EVENT_FAIL_BLE) ? "Firmware BLE ERROR!!!" :
+				(event == DUT_EVENT_FAIL_BOTH) ? "Firmware ZB+BLE ERROR!!!" : "Firmware ZigBee ERROR!!!";
+		expect(textMatches(4, wY + PANE_FAIL_MSG_Y, pcMsg, 16), "thong bao loi", pSim->sess.byChannel);
+		expect(textMatches(PANE_MAC_X, wY + PANE_FAIL_MAC_Y, pcMAC, 16), "MAC DUT loi", pSim->sess.byChannel);
+		expect(textMatches(PANE_STATUS_X, wY + PANE_STATUS_Y, eventName(event), 16),
+			   "chu FAIL", pSim->sess.byChannel);
+		expect(ili9341EmuPixel(PANE_BOX_X, wY + PANE_BOX_Y) == RED, "o mau do", pSim->sess.byChannel);
+	}
+	expect(textMatches(4, wY + PANE_STATUS_Y, pSim->pane.pcTitle, 16), "tieu de DUT n", pSim->sess.byChannel);
+}
+
+static void simEvent(DutSession_t *pSess,DutEvent_e event,const CmdData_t *pCmd)
+{
+	SimChannel_t *pSim = &g_pSimCh[pSess->byChannel];
+	const SimChannel_t *pOther = &g_pSimCh[pSess->byChannel ^ 1];
+	//Ca man hinh: khong co o kenh kia, so vung trong duoi o
+	u16 wOtherY = (pSim->pane.wHeight == RESULT_PANE_HEIGHT) ? pOther->pane.wY : RESULT_PANE_Y0 + RESULT_PANE_FULL_HEIGHT;
+	u16 wOtherYe = (pSim->pane.wHeight == RESULT_PANE_HEIGHT) ? wOtherY + RESULT_PANE_HEIGHT - 1 : LCD_H - 1;
+	uint32_t dwOther = rowsHash(wOtherY, wOtherYe);
+	uint32_t dwIncBytes, dwFullBytes, dwIncUs, dwIncHash;
+	uint8_t byDut = (uint8_t)(MAC_LOW48(pSess->qwMACLast) - MAC_LOW48(SIM_MAC_BASE));
+	uint8_t bySameLayout = (pSim->byLayout == 1 + event) && (pSim->layoutMode == g_mode);
+
+	if(event == DUT_EVENT_NEW_DUT)
+	{
+		//dutChannelFlush
+		uartChannelReset(&pSim->uartCh);
+		scratchArenaReset();
+		return;
+	}
+	pSim->byEvents++;
+
+	//Ve nhu main.c (tung phan neu cung bo cuc), roi ve lai ca o de so sanh
+	ili9341EmuStatsClear();
+	simDraw(pSim, event, pCmd);
+	dwIncBytes = g_ili9341EmuStats.dwPixelBytes;
+	dwIncUs = ili9341EmuWireUs(SPI_HZ);
+	dwIncHash = rowsHash(pSim->pane.wY, pSim->pane.wY + pSim->pane.wHeight - 1);
+	simCheckPane(pSim, event, byDut);
+
+	resultPaneInvalidate(&pSim->pane);
+	ili9341EmuStatsClear();
+	simDraw(pSim, event, pCmd);
+	dwFullBytes = g_ili9341EmuStats.dwPixelBytes;
+	expect(rowsHash(pSim->pane.wY, pSim->pane.wY + pSim->pane.wHeight - 1) == dwIncHash,
+		   "ve tung phan khac ve ca o", pSess->byChannel);
+	expect(rowsHash(wOtherY, wOtherYe) == dwOther, "ve de len o kenh kia", pSess->byChannel);
+	if(bySameLayout)
+	{
+		expect(dwIncBytes < dwFullBytes, "ve tung phan khong it byte hon", pSess->byChannel);
+	}
+	expect(g_ili9341EmuStats.dwErrors == 0, "loi giao thuc", g_ili9341EmuStats.dwErrors);
+
+	printf("  DUT %u  %-6s %-5s %-16s %s  pixel %6u/%6u B  %5u us\n", pSess->byChannel + 1,
+		   (g_mode == DUAL_MODE) ? "dual" : (g_mode == ZIGBEE_MODE) ? "zigbee" : "ble",
+		   (pSim->pane.wHeight == RESULT_PANE_HEIGHT) ? "nua" : "ca",
+		   eventName(event),
+		   bySameLayout ? "tung phan" : "ca o     ", dwIncBytes, dwFullBytes, dwIncUs);
+	pSim->byLayout = 1 + event;
+	pSim->layoutMode = g_mode;
+}
+
+// Goi tu procUartChannelCmd
+static void simUartEvent(uint8_t byChannel,void *arg)
+{
+	const CmdData_t *pCmd = arg;
+
+	if(pCmd->byCmdId == CMD_ID_ZIGBEE_AND_BLE)
+	{
+		dutSessionOnRadio(&g_pSimCh[byChannel].sess, pCmd, g_mode);
+	}else if(pCmd->byCmdId == CMD_ID_MCU_TOUCH)
+	{
+		dutSessionOnMcu(&g_pSimCh[byChannel].sess, arg);
+	}
+}
+
+/******************************************************************************/
+/*                               Phat lai                                     */
+/******************************************************************************/
+// Cac kenh nhan xen ke tung byte; vong lap chinh xu ly sau moi byte. Chi
+// byChannels kenh dau co DUT
+static void simRun(TestSwMode_e mode,const SimDut_t pDut[SIM_CH_CNT][SIM_DUT_MAX],uint8_t byDuts,uint8_t byChannels)
+{
+	uint8_t byBusy = 1;
+
+	g_mode = mode;
+	for(uint8_t c = 0; c < SIM_CH_CNT; c++)
+	{
+		SimChannel_t *pSim = &g_pSimCh[c];
+
+		uartChannelInit(&pSim->uartCh, c, simUartEvent);
+		dutSessionInit(&pSim->sess, c, simEvent);
+		simBuildStream(pSim, pDut[c], (c < byChannels) ? byDuts : 0);
+		pSim->byEvents = 0;
+	}
+	while(byBusy)
+	{
+		byBusy = 0;
+		for(uint8_t c = 0; c < SIM_CH_CNT; c++)
+		{
+			SimChannel_t *pSim = &g_pSimCh[c];
+
+			if(pSim->wPos < pSim->wLen)
+			{
+				uartChannelPutByte(&pSim->uartCh, pSim->pbyStream[pSim->wPos++]);
+				byBusy = 1;
+			}
+		}
+		for(uint8_t c = 0; c < SIM_CH_CNT; c++)
+		{
+			uartChannelProcess(&g_pSimCh[c].uartCh);
+		}
+	}
+	for(uint8_t c = 0; c < SIM_CH_CNT; c++)
+	{
+		expect(g_pSimCh[c].byEvents == ((c < byChannels) ? byDuts : 0), "so ket qua cua kenh", c);
+		expect(g_pSimCh[c].uartCh.wErrorCnt == 0 && g_pSimCh[c].uartCh.wDropCnt == 0, "mat khung", c);
+	}
+}
+
+int main(void)
+{
+	//Kenh 1 va 2 cung che do, khac MAC/so nut; moi kenh co DUT loi
+	static const SimDut_t pDual[SIM_CH_CNT][SIM_DUT_MAX] = {
+		{{0x01, 2, DUT_OK}, {0x02, 1, DUT_BLE_MISMATCH}, {0x03, 4, DUT_OK}, {0x04, 3, DUT_OK}},
+		{{0x11, 3, DUT_OK}, {0x12, 1, DUT_OK}, {0x13, 2, DUT_ZIGBEE_MISMATCH}, {0x14, 2, DUT_BOTH_MISMATCH}},
+	};
+	static const SimDut_t pZigbee[SIM_CH_CNT][SIM_DUT_MAX] = {
+		{{0x21, 1, DUT_OK}, {0x22, 2, DUT_OK}},
+		{{0x31, 2, DUT_ZIGBEE_MISMATCH}, {0x32, 3, DUT_OK}},
+	};
+	static const SimDut_t pBle[SIM_CH_CNT][SIM_DUT_MAX] = {
+		{{0x41, 4, DUT_BLE_MISMATCH}, {0x42, 1, DUT_OK}},
+		{{0x51, 2, DUT_OK}, {0x52, 2, DUT_OK}},
+	};
+
+	srand(1);
+	for(int i = 0; i < 95; i++)
+	{
+		for(int r = 0; r < 12; r++) asc2_1206[i][r] = rand() & 0x3F;
+		for(int r = 0; r < 16; r++) asc2_1608[i][r] = rand() & 0xFF;
+	}
+	ili9341EmuReset(0x1234);
+	g_iHostPowerOnReset = 1;
+	expect(LCD_SeqInit() == 0, "cold init", 0);
+	LCD_SeqFill(0, 0, LCD_W - 1, LCD_H - 1, WHITE);
+	scratchArenaReset();
+	for(uint8_t c = 0; c < SIM_CH_CNT; c++)
+	{
+		memset(&g_pSimCh[c], 0, sizeof(g_pSimCh[c]));
+		resultPaneInit(&g_pSimCh[c].pane, c);
+	}
+	expect(g_pSimCh[1].pane.wY + RESULT_PANE_HEIGHT <= LCD_H, "o 2 ra ngoai man hinh", g_pSimCh[1].pane.wY);
+	expect(paneMacY(&g_pSimCh[0].pane) + PANE_MODEL_DY + 16 <= RESULT_PANE_HEIGHT, "Model ra ngoai o", 0);
+
+	simRun(DUAL_MODE, pDual, 4, SIM_CH_CNT);
+	ili9341EmuSavePpm("build/result-pane-dual.ppm");
+	simRun(ZIGBEE_MODE, pZigbee, 2, SIM_CH_CNT);
+	simRun(BLE_MODE, pBle, 2, SIM_CH_CNT);
+	ili9341EmuSavePpm("build/result-pane-ble.ppm");
+
+	//Chi kenh 1 co DUT: o chiem ca man hinh nhu resultScreenLayout cua main.c
+	LCD_SeqFill(0, RESULT_PANE_Y0, LCD_W - 1, LCD_H - 1, WHITE);
+	resultPaneSetArea(&g_pSimCh[0].pane, RESULT_PANE_Y0, RESULT_PANE_FULL_HEIGHT);
+	expect(g_pSimCh[0].pane.byQrScale > RESULT_PANE_QR_SCALE_SPLIT, "ca man hinh: QR to hon", 0);
+	expect(paneMacY(&g_pSimCh[0].pane) + PANE_MODEL_DY + 16 <= RESULT_PANE_FULL_HEIGHT, "ca man hinh: Model ra ngoai o", 0);
+	simRun(DUAL_MODE, pDual, 4, 1);
+	simRun(ZIGBEE_MODE, pZigbee, 2, 1);
+	ili9341EmuSavePpm("build/result-pane-full.ppm");
+
+	//Thanh tieu de phia tren 2 o khong bi ve
+	for(u16 y = 0; y < RESULT_PANE_Y0; y++)
+		for(u16 x = 0; x < LCD_W; x++)
+			if(ili9341EmuPixel(x, y) != WHITE)
+			{
+				expect(0, "ve vao thanh tieu de", y);
+				y = RESULT_PANE_Y0;
+				break;
+			}
+	expect(scratchArenaStats()->wFailCnt == 0, "het vung nho tam", scratchArenaStats()->wFailCnt);
+
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *				 _ _                                             _ _
+				|   |                                           (_ _)
+				|   |        _ _     _ _   _ _ _ _ _ _ _ _ _ _   _ _
+				|   |       |   |   |   | |    _ _     _ _    | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |       |   |   |   | |   |   |   |   |   | |   |
+				|   |_ _ _  |   |_ _|   | |   |   |   |   |   | |   |
+				|_ _ _ _ _| |_ _ _ _ _ _| |_ _|   |_ _|   |_ _| |_ _|
+								(C)2023 Lumi
+ * Copyright (c) 2023
+ * Lumi, JSC.
+ * All Rights Reserved
+ *
+ * File name: test-swar-kernels.c
+ *
+ * Description: Kiem tra cac ham SWAR cho ket qua giong ban tung byte (moi do dai,
+ *              moi do lech dia chi) va cac ham ghep chuoi dung kHexEncode. Dich 2 lan:
+ *              ban C thuan va ban __ARM_FEATURE_DSP voi intrinsic gia lap.
+ *
+ * Author: CuuNV
+ *
+ * Last Changed By:  $Author: CuuNV $
+ * Revision:         $Revision: $
+ * Last Changed:     $Date: $Mar 06, 2023
+ *
+ * Code sample:
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "swar-kernels.h"
+#include "str-builder.h"
+
+static int iFail;
+
+static void expect(int iOk,const char *pcWhat,int a,int b)
+{
+	if(!iOk)
+	{
+		printf("FAIL %s (%d,%d)\n", pcWhat, a, b);
+		iFail++;
+	}
+}
+
+static void testXor(void)
+{
+	uint8_t pbyBuf[80];
+	uint8_t byRef;
+
+	for(unsigned i = 0; i < sizeof(pbyBuf); i++) pbyBuf[i] = rand();
+	for(int iOff = 0; iOff < 4; iOff++)
+		for(int iLen = 0; iLen + iOff <= 76; iLen++)
+		{
+			byRef = 0;
+			for(int i = 0; i < iLen; i++) byRef ^= pbyBuf[iOff + i];
+			expect(kXorChecksum(&pbyBuf[iOff], iLen) == byRef, "kXorChecksum", iOff, iLen);
+		}
+}
+
+static void testSwap(void)
+{
+	uint8_t pbySrc[68], pbyDst[68], pbyRef[68];
+
+	for(unsigned i = 0; i < sizeof(pbySrc); i++) pbySrc[i] = rand();
+	for(int iOff = 0; iOff < 4; iOff++)
+		for(int iPix = 0; iPix*2 + iOff <= 64; iPix++)
+		{
+			for(int i = 0; i < iPix; i++)
+			{
+				pbyRef[2*i] = pbySrc[iOff + 2*i + 1];
+				pbyRef[2*i + 1] = pbySrc[iOff + 2*i];
+			}
+			kSwapRgb565(&pbyDst[iOff], &pbySrc[iOff], iPix);
+			expect(!memcmp(&pbyDst[iOff], pbyRef, iPix*2), "kSwapRgb565", iOff, iPix);
+			//Tai cho (bo dem dich trung nguon)
+			memcpy(pbyDst, pbySrc, sizeof(pbyDst));
+			kSwapRgb565(&pbyDst[iOff], &pbyDst[iOff], iPix);
+			expect(!memcmp(&pbyDst[iOff], pbyRef, iPix*2), "kSwapRgb565 in place", iOff, iPix);
+		}
+}
+
+static void testHex(void)
+{
+	uint8_t pbyIn[256];
+	char pcOut[2*256 + 1], pcRef[2*256 + 1];
+
+	for(int i = 0; i < 256; i++) pbyIn[i] = i;
+	for(int i = 0; i < 256; i++) sprintf(&pcRef[2*i], "%02X", pbyIn[i]);
+	for(int iOff = 0; iOff < 4; iOff++)
+		for(int iLen = 0; iLen + iOff <= 255; iLen += (iLen < 9) ? 1 : 37)
+		{
+			memset(pcOut, '#', sizeof(pcOut));
+			kHexEncode(pcOut, &pbyIn[iOff], iLen);
+			expect(!memcmp(pcOut, &pcRef[2*iOff], 2*iLen) && pcOut[2*iLen] == 0, "kHexEncode", iOff, iLen);
+		}
+}
+
+static void testBuilder(void)
+{
+	static const uint8_t pbyMac[8] = { 0x00, 0x0D, 0x6F, 0xFF, 0xFE, 0xA1, 0xB2, 0xC3 };
+	char pcBuf[32];
+	StrBuilder_t sb;
+
+	sbInit(&sb, pcBuf, sizeof(pcBuf));
+	sbAppendStr(&sb, "MAC ");
+	sbAppendHexSep(&sb, pbyMac, 8, ':');
+	expect(!strcmp(pcBuf, "MAC 00:0D:6F:FF:FE:A1:B2:C3") && !sb.byOverflow, "sbAppendHexSep", sb.wLen, 0);
+
+	sbInit(&sb, pcBuf, sizeof(pcBuf));
+	sbAppendHexValue(&sb, 0x000D6FFFFEA1B2C3ULL, 6, '-');
+	sbAppendHexValue(&sb, 0x0102, 2, 0);
+	sbAppendHexSep(&sb, pbyMac, 1, ':');
+	expect(!strcmp(pcBuf, "6F-FF-FE-A1-B2-C3010200"), "sbAppendHexValue", sb.wLen, 0);
+
+	//Khong du cho: khong ghi gi, bao tran
+	sbInit(&sb, pcBuf, 8);
+	sbAppendStr(&sb, "ab");
+	sbAppendHexSep(&sb, pbyMac, 2, ':');
+	expect(!strcmp(pcBuf, "ab00:0D") && !sb.byOverflow, "sbAppendHexSep fits", sb.wLen, 0);
+	sbAppendHexSep(&sb, pbyMac, 1, ':');
+	expect(!strcmp(pcBuf, "ab00:0D") && sb.byOverflow, "sbAppendHexSep overflow", sb.wLen, 0);
+
+	sbInit(&sb, pcBuf, 8);
+	sbAppendStr(&sb, "v");
+	sbAppendDec(&sb, 0);
+	sbAppendDec(&sb, 4294967295u);
+	expect(!strcmp(pcBuf, "v0") && sb.byOverflow, "sbAppendDec overflow", sb.wLen, 0);
+	sbAppendDec(&sb, 12345);
+	expect(!strcmp(pcBuf, "v012345") && sb.wLen == 7, "sbAppendDec fits", sb.wLen, 0);
+}
+
+int main(void)
+{
+	srand(2);
+	testXor();
+	testSwap();
+	testHex();
+	testBuilder();
+	printf("%s\n", iFail ? "FAIL" : "PASS");
+	return iFail ? 1 : 0;
+}
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ File name: stack-depth.py
+
+ Description: Uoc luong do sau stack xau nhat cho tung diem vao (luong chinh
+              va cac ngat) bang cach ghep khung stack trong cac file .su voi
+              do thi goi ham lay tu file .list (objdump) va .map.
+
+ Cach dung (tu thu muc goc du an, sau khi build Debug):
+     python3 tools/stack-depth.py Debug
+
+ Ham dat trong .RamFunc nam trong .data nen objdump mac dinh khong dich
+ nguoc; them file list cua .data de thay duoc cac ham no goi:
+     arm-none-eabi-objdump -d -j .data Debug/<ten>.elf > Debug/ram.list
+     python3 tools/stack-depth.py Debug --list Debug/ram.list
+
+ Goi qua con tro ham (callback, bang su kien) khong suy ra duoc tu ma may;
+ khai bao them bang --call "caller:callee".
+
+ Ghi chu:
+   - "*" : khung co VLA/alloca ma .su bao "dynamic" (khong chan tren), so
+           in ra la gia tri toi thieu.
+   - "R" : co de quy, do sau chi tinh 1 vong.
+   - "?" : co goi gian tiep khong giai duoc.
+   - Build LTO (Release): file .su cua tung file .o mo ta ma truoc LTO, khong
+     khop voi ma may cuoi cung. Release truyen -fstack-usage cho buoc link
+     nen GCC ghi <ten>.elf.ltransN.ltrans.su cho ma sau LTO; khi co cac file
+     nay script chi doc chung va bo qua .su cua tung file .o.
+"""
+import argparse
+import os
+import re
+import sys
+
+# Khung ngat phan cung Cortex-M4F: 8 tu, 26 tu khi co ngu canh FPU
+EXC_FRAME_BASIC = 32
+EXC_FRAME_FPU = 104
+
+RE_SU = re.compile(r'^(.*?):\d+:\d+:(\S+)\s+(\d+)\s+(\S+)\s*$')
+RE_FUNC = re.compile(r'^([0-9a-f]{8}) <([^>]+)>:\s*$')
+RE_INSN = re.compile(r'^\s*([0-9a-f]+):\s+[0-9a-f]{4}(?: ?[0-9a-f]{4})?\s+(\S+)\s*(.*)$')
+RE_WORD = re.compile(r'^\s*([0-9a-f]+):\s+[0-9a-f]{8}\s+\.word\s+0x([0-9a-f]+)')
+RE_TARGET = re.compile(r'<([^>+]+)(\+0x[0-9a-f]+)?>')
+RE_LDR_LIT = re.compile(r'^(r\d+|ip|lr), \[pc, #-?\d+\]\s*[;@]\s*\(([0-9a-f]+)')
+RE_MAP_SYM = re.compile(r'^\s+0x([0-9a-f]+)\s+([A-Za-z_]\w*)\s*$')
+RE_BRANCH = re.compile(r'^b(?:eq|ne|cs|hs|cc|lo|mi|pl|vs|vc|hi|ls|ge|lt|gt|le|al)?(?:\.[nw])?$')
+
+
+def base_name(name):
+    # foo.constprop.0 / foo.isra.0 / foo.part.0 / foo.lto_priv.0 -> foo
+    return name.split('.', 1)[0]
+
+
+def load_su(root):
+    paths = [os.path.join(path, fn) for path, _, files in os.walk(root)
+             for fn in files if fn.endswith('.su')]
+    # Co .su cua buoc link LTO thi .su tung file .o da loi thoi
+    ltrans = [p for p in paths if p.endswith('.ltrans.su')]
+    frames = {}
+    for p in ltrans or paths:
+        with open(p, errors='replace') as f:
+            for line in f:
+                m = RE_SU.match(line)
+                if not m:
+                    continue
+                name = m.group(2)
+                size = int(m.group(3))
+                dynamic = 'dynamic' in m.group(4) and 'bounded' not in m.group(4)
+                old = frames.get(name)
+                # Ham static trung ten o nhieu file: lay khung lon nhat
+                if old is None or size > old[0]:
+                    frames[name] = (size, dynamic or (old is not None and old[1]))
+    return frames
+
+
+def load_map(paths):
+    symbols = {}
+    for p in paths:
+        with open(p, errors='replace') as f:
+            for line in f:
+                m = RE_MAP_SYM.match(line)
+                if m:
+                    symbols[int(m.group(1), 16) & ~1] = m.group(2)
+    return symbols
+
+
+def load_list(paths, symbols, graph, indirect):
+    for p in paths:
+        words = {}
+        lines = []
+        with open(p, errors='replace') as f:
+            for line in f:
+                lines.append(line)
+                m = RE_WORD.match(line)
+                if m:
+                    words[int(m.group(1), 16)] = int(m.group(2), 16)
+        cur = None
+        regs = {}
+        for line in lines:
+            m = RE_FUNC.match(line)
+            if m:
+                cur = m.group(2)
+                graph.setdefault(cur, set())
+                symbols.setdefault(int(m.group(1), 16), cur)
+                regs = {}
+                continue
+            if cur is None:
+                continue
+            m = RE_INSN.match(line)
+            if not m:
+                continue
+            op, args = m.group(2), m.group(3)
+            lit = RE_LDR_LIT.match(args) if op in ('ldr', 'ldr.w') else None
+            if lit:
+                value = words.get(int(lit.group(2), 16))
+                if value is not None:
+                    regs[lit.group(1)] = value
+                continue
+            if op in ('bl', 'blx') and '<' in args:
+                t = RE_TARGET.search(args)
+                if t:
+                    graph[cur].add(t.group(1))
+            elif op == 'blx' or (op == 'bx' and args.split()[0] != 'lr'):
+                reg = args.split()[0]
+                target = symbols.get(regs.get(reg, 0) & ~1)
+                if target:
+                    graph[cur].add(target)
+                else:
+                    indirect.add(cur)
+            elif RE_BRANCH.match(op):
+                # Nhay sang dau ham khac = goi duoi (tail call)
+                t = RE_TARGET.search(args)
+                if t and t.group(2) is None and t.group(1) != cur:
+                    graph[cur].add(t.group(1))
+
+
+def depth(name, graph, frames, indirect, memo, path):
+    if name in memo:
+        return memo[name]
+    frame = frames.get(name) or frames.get(base_name(name)) or (0, False)
+    flags = set()
+    if frame[1]:
+        flags.add('*')
+    if name in indirect:
+        flags.add('?')
+    best = 0
+    best_path = []
+    path.add(name)
+    for callee in sorted(graph.get(name, ())):
+        if callee in path:
+            flags.add('R')
+            continue
+        d, f, p = depth(callee, graph, frames, indirect, memo, path)
+        flags |= f
+        if d > best:
+            best = d
+            best_path = p
+    path.discard(name)
+    memo[name] = (frame[0] + best, flags, [name] + best_path)
+    return memo[name]
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Worst-case stack depth from .su + .list/.map')
+    ap.add_argument('build', help='thu muc build (Debug/Release)')
+    ap.add_argument('--list', action='append', default=[], help='them file .list')
+    ap.add_argument('--map', action='append', default=[], help='them file .map')
+    ap.add_argument('--call', action='append', default=[], help='canh goi gian tiep "caller:callee"')
+    ap.add_argument('--entry', action='append', default=[], help='them diem vao')
+    ap.add_argument('--no-fpu', action='store_true', help='khung ngat 32 byte thay vi 104')
+    ap.add_argument('--stack-size', type=lambda v: int(v, 0), default=None,
+                    help='vung du phong de so sanh (mac dinh doc _Min_Stack_Size trong .map)')
+    ap.add_argument('--verbose', action='store_true', help='in chuoi goi sau nhat')
+    args = ap.parse_args()
+
+    lists = args.list + [os.path.join(args.build, f) for f in os.listdir(args.build) if f.endswith('.list')
+                         and f != 'objects.list']
+    maps = args.map + [os.path.join(args.build, f) for f in os.listdir(args.build) if f.endswith('.map')]
+    if not lists:
+        sys.exit('khong tim thay file .list trong ' + args.build)
+
+    frames = load_su(args.build)
+    symbols = load_map(maps)
+    graph = {}
+    indirect = set()
+    load_list(lists, symbols, graph, indirect)
+    for c in args.call:
+        caller, callee = c.split(':', 1)
+        graph.setdefault(caller, set()).add(callee)
+        indirect.discard(caller)
+
+    stack_size = args.stack_size
+    if stack_size is None:
+        for p in maps:
+            with open(p, errors='replace') as f:
+                m = re.search(r'0x([0-9a-f]+)\s+_Min_Stack_Size = ', f.read())
+                if m:
+                    stack_size = int(m.group(1), 16)
+
+    # Diem vao: Reset_Handler (luong chinh) va moi ham *_Handler/*IRQHandler
+    # co khung trong .su (bo qua cac ten tro vao Default_Handler)
+    thread = 'Reset_Handler' if 'Reset_Handler' in graph else 'main'
+    isrs = sorted(n for n in graph if n != thread and
+                  (n.endswith('_Handler') or n.endswith('IRQHandler')) and
+                  (n in frames or graph[n]) and n != 'Default_Handler')
+    isrs += [e for e in args.entry if e not in isrs]
+    exc = EXC_FRAME_BASIC if args.no_fpu else EXC_FRAME_FPU
+
+    memo = {}
+    rows = []
+    d, f, p = depth(thread, graph, frames, indirect, memo, set())
+    rows.append((thread, d, f, p))
+    isr_total = 0
+    isr_max = 0
+    for n in isrs:
+        d, f, p = depth(n, graph, frames, indirect, memo, set())
+        rows.append((n, d + exc, f, p))
+        isr_total += d + exc
+        isr_max = max(isr_max, d + exc)
+
+    print('%-32s %8s  %s' % ('Diem vao', 'Byte', 'Co'))
+    for n, d, f, p in rows:
+        print('%-32s %8d  %s' % (n, d, ''.join(sorted(f))))
+        if args.verbose:
+            print('    ' + ' -> '.join(p))
+    print()
+    print('Luong chinh + 1 ngat sau nhat    : %d' % (rows[0][1] + isr_max))
+    print('Luong chinh + tat ca ngat long nhau: %d' % (rows[0][1] + isr_total))
+    if stack_size is not None:
+        print('Vung du phong _Min_Stack_Size    : %d' % stack_size)
+    if indirect:
+        print('\nGoi gian tiep chua giai (--call): ' + ', '.join(sorted(indirect)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())